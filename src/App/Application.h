@@ -272,6 +272,12 @@ public:
     boost::signals2::signal<void (const App::DocumentObject&, const App::Property&)> signalChangedObject;
     /// signal on relabeled Object
     boost::signals2::signal<void (const App::DocumentObject&)> signalRelabelObject;
+    /// signal on changed Object, deferred and coalesced while a NotificationBatch is active
+    boost::signals2::signal<void (const App::DocumentObject&, const App::Property&)> signalBatchedChangedObject;
+    /// signal before delivering the changes batched by NotificationBatch
+    boost::signals2::signal<void ()> signalBeforeBatchedChanges;
+    /// signal after delivering the changes batched by NotificationBatch
+    boost::signals2::signal<void ()> signalAfterBatchedChanges;
     /// signal on activated Object
     boost::signals2::signal<void (const App::DocumentObject&)> signalActivatedObject;
     /// signal before recomputed document
@@ -561,6 +567,8 @@ private:
     static PyObject *sSetActiveTransaction  (PyObject *self,PyObject *args);
     static PyObject *sGetActiveTransaction  (PyObject *self,PyObject *args);
     static PyObject *sCloseActiveTransaction(PyObject *self,PyObject *args);
+    static PyObject *sBeginNotificationBatch(PyObject *self,PyObject *args);
+    static PyObject *sEndNotificationBatch  (PyObject *self,PyObject *args);
     static PyObject *sCheckAbort(PyObject *self,PyObject *args);
     static PyMethodDef    Methods[];
 
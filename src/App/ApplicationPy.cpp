@@ -36,6 +36,7 @@
 #include "DocumentPy.h"
 #include "DocumentObserverPython.h"
 #include "DocumentObjectPy.h"
+#include "NotificationBatch.h"
 
 
 //using Base::GetConsole;
@@ -172,6 +173,14 @@ PyMethodDef Application::Methods[] = {
      "getActiveTransaction() -> (name,id) return the current active transaction name and ID"},
     {"closeActiveTransaction", (PyCFunction) Application::sCloseActiveTransaction, METH_VARARGS,
      "closeActiveTransaction(abort=False) -- commit or abort current active transaction"},
+    {"beginNotificationBatch", (PyCFunction) Application::sBeginNotificationBatch, METH_VARARGS,
+     "beginNotificationBatch() -- batch the change notification of document objects\n\n"
+     "Document observers implementing slotBatchedChangedObject() are notified once per\n"
+     "object and property when the matching call of endNotificationBatch() is made.\n"
+     "slotChangedObject() is still called immediately. Calls can be nested. Use the\n"
+     "context manager FreeCAD.NotificationBatch to make sure the batch is ended."},
+    {"endNotificationBatch", (PyCFunction) Application::sEndNotificationBatch, METH_VARARGS,
+     "endNotificationBatch() -- end a batch started by beginNotificationBatch()"},
     {"isRestoring", (PyCFunction) Application::sIsRestoring, METH_VARARGS,
      "isRestoring() -> Bool -- Test if the application is opening some document"},
     {"checkAbort", (PyCFunction) Application::sCheckAbort, METH_VARARGS,
@@ -958,6 +967,29 @@ PyObject *Application::sCloseActiveTransaction(PyObject * /*self*/, PyObject *ar
     } PY_CATCH;
 }
 
+PyObject *Application::sBeginNotificationBatch(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    NotificationBatch::begin();
+    Py_Return;
+}
+
+PyObject *Application::sEndNotificationBatch(PyObject * /*self*/, PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    PY_TRY {
+        if (!NotificationBatch::end()) {
+            PyErr_SetString(PyExc_RuntimeError, "No active notification batch");
+            return nullptr;
+        }
+        Py_Return;
+    } PY_CATCH;
+}
+
 PyObject *Application::sCheckAbort(PyObject * /*self*/, PyObject *args)
 {
     if (!PyArg_ParseTuple(args, ""))
@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <array>
+#include <cmath>
+#include <limits>
+#endif
+
+#include <Base/Exception.h>
+
+#include "CompiledExpression.h"
+#include "ExpressionParser.h"
+#include "PropertyStandard.h"
+#include "PropertyUnits.h"
+
+using namespace App;
+
+namespace
+{
+// Integers are kept as double, so only those which can be represented exactly
+// take the fast path. Larger values are left to Python's arbitrary precision integers.
+constexpr double maxInteger = 9007199254740992.0;  // 2^53
+
+bool isExactInteger(double value)
+{
+    double intpart;
+    return std::modf(value, &intpart) == 0.0 && std::fabs(value) <= maxInteger;
+}
+}  // namespace
+
+std::unique_ptr<CompiledExpression> CompiledExpression::compile(const Expression* expr)
+{
+    if (!expr) {
+        return {};
+    }
+
+    std::unique_ptr<CompiledExpression> compiled(new CompiledExpression);
+    if (!compiled->compileNode(expr, 1)) {
+        return {};
+    }
+    return compiled;
+}
+
+bool CompiledExpression::compileNode(const Expression* expr, int depth)
+{
+    if (depth > MaxStackSize || expr->hasComponent()) {
+        return false;
+    }
+
+    if (expr->isDerivedFrom<OperatorExpression>()) {
+        auto opExpr = static_cast<const OperatorExpression*>(expr);
+        OpCode op;
+        switch (opExpr->getOperator()) {
+            case OperatorExpression::ADD:
+                op = OpCode::Add;
+                break;
+            case OperatorExpression::SUB:
+                op = OpCode::Sub;
+                break;
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                op = OpCode::Mul;
+                break;
+            case OperatorExpression::DIV:
+                op = OpCode::Div;
+                break;
+            case OperatorExpression::NEG:
+                if (!compileNode(opExpr->getLeft(), depth)) {
+                    return false;
+                }
+                code.push_back({OpCode::Neg, 0});
+                return true;
+            case OperatorExpression::POS:
+                return compileNode(opExpr->getLeft(), depth);
+            default:
+                return false;
+        }
+        if (!compileNode(opExpr->getLeft(), depth) || !compileNode(opExpr->getRight(), depth + 1)) {
+            return false;
+        }
+        code.push_back({op, 0});
+        return true;
+    }
+
+    if (expr->isDerivedFrom<VariableExpression>()) {
+        ObjectIdentifier var = static_cast<const VariableExpression*>(expr)->getPath();
+        if (var.numSubComponents() > 0) {
+            return false;
+        }
+        code.push_back({OpCode::Variable, static_cast<uint32_t>(variables.size())});
+        variables.push_back(std::move(var));
+        return true;
+    }
+
+    // Any other kind of UnitExpression evaluates to something else than its quantity
+    if (!expr->is<NumberExpression>() && !expr->is<UnitExpression>()
+        && !expr->is<ConstantExpression>()) {
+        return false;
+    }
+    if (expr->is<ConstantExpression>() && !static_cast<const ConstantExpression*>(expr)->isNumber()) {
+        return false;
+    }
+
+    // Same conversion as pyFromQuantity()
+    Value value;
+    value.quantity = static_cast<const UnitExpression*>(expr)->getQuantity();
+    if (!value.quantity.getUnit().isEmpty()) {
+        value.type = ValueType::Quantity;
+    }
+    else if (isExactInteger(value.quantity.getValue())) {
+        value.type = ValueType::Integer;
+    }
+    else {
+        double intpart;
+        if (std::modf(value.quantity.getValue(), &intpart) == 0.0) {
+            // Too big to be represented exactly
+            return false;
+        }
+        value.type = ValueType::Float;
+    }
+    code.push_back({OpCode::Constant, static_cast<uint32_t>(constants.size())});
+    constants.push_back(value);
+    return true;
+}
+
+bool CompiledExpression::getVariable(const ObjectIdentifier& var, Value& value) const
+{
+    int ptype = 0;
+    Property* prop = var.getProperty(&ptype);
+    if (!prop || ptype != 0) {
+        return false;
+    }
+
+    // Same type the property returns to Python
+    if (prop->isDerivedFrom<PropertyQuantity>()) {
+        value.quantity = static_cast<PropertyQuantity*>(prop)->getQuantityValue();
+        value.type = ValueType::Quantity;
+    }
+    else if (prop->isDerivedFrom<PropertyFloat>()) {
+        value.quantity = Base::Quantity(static_cast<PropertyFloat*>(prop)->getValue());
+        value.type = ValueType::Float;
+    }
+    else if (prop->isDerivedFrom<PropertyInteger>()) {
+        auto l = static_cast<PropertyInteger*>(prop)->getValue();
+        value.quantity = Base::Quantity(static_cast<double>(l));
+        value.type = ValueType::Integer;
+        return isExactInteger(value.quantity.getValue());
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+bool CompiledExpression::calc(OpCode op, Value& left, const Value& right)
+{
+    // Python rules: quantities win, then floats, integers stay integers except for division
+    if (left.type == ValueType::Quantity || right.type == ValueType::Quantity) {
+        switch (op) {
+            case OpCode::Add:
+                left.quantity = left.quantity + right.quantity;
+                break;
+            case OpCode::Sub:
+                left.quantity = left.quantity - right.quantity;
+                break;
+            case OpCode::Mul:
+                left.quantity = left.quantity * right.quantity;
+                break;
+            case OpCode::Div:
+                left.quantity = left.quantity / right.quantity;
+                break;
+            default:
+                return false;
+        }
+        left.type = ValueType::Quantity;
+        return true;
+    }
+
+    double a = left.quantity.getValue();
+    double b = right.quantity.getValue();
+    double res;
+    switch (op) {
+        case OpCode::Add:
+            res = a + b;
+            break;
+        case OpCode::Sub:
+            res = a - b;
+            break;
+        case OpCode::Mul:
+            res = a * b;
+            break;
+        case OpCode::Div:
+            if (b == 0.0) {
+                // Let Python raise ZeroDivisionError
+                return false;
+            }
+            res = a / b;
+            break;
+        default:
+            return false;
+    }
+
+    if (left.type == ValueType::Integer && right.type == ValueType::Integer && op != OpCode::Div) {
+        if (std::fabs(res) > maxInteger) {
+            return false;
+        }
+    }
+    else {
+        left.type = ValueType::Float;
+    }
+    left.quantity = Base::Quantity(res);
+    return true;
+}
+
+bool CompiledExpression::eval(App::any& value) const
+{
+    std::array<Value, MaxStackSize> stack;
+    int top = -1;
+
+    try {
+        for (const auto& instr : code) {
+            switch (instr.op) {
+                case OpCode::Constant:
+                    stack[++top] = constants[instr.index];
+                    break;
+                case OpCode::Variable:
+                    if (!getVariable(variables[instr.index], stack[++top])) {
+                        return false;
+                    }
+                    break;
+                case OpCode::Neg: {
+                    Value& v = stack[top];
+                    if (v.type == ValueType::Quantity) {
+                        v.quantity = v.quantity * -1.0;
+                    }
+                    else {
+                        v.quantity = Base::Quantity(-v.quantity.getValue());
+                    }
+                    break;
+                }
+                default:
+                    --top;
+                    if (!calc(instr.op, stack[top], stack[top + 1])) {
+                        return false;
+                    }
+                    break;
+            }
+        }
+    }
+    catch (Base::Exception&) {
+        // E.g. unit mismatch, the error is reported by the expression itself
+        return false;
+    }
+
+    if (top != 0) {
+        return false;
+    }
+
+    const Value& result = stack[0];
+    switch (result.type) {
+        case ValueType::Integer: {
+            // long may have only 32 bits, e.g. on Windows
+            double integer = result.quantity.getValue();
+            if (integer < static_cast<double>(std::numeric_limits<long>::min())
+                || integer > static_cast<double>(std::numeric_limits<long>::max())) {
+                return false;
+            }
+            value = static_cast<long>(integer);
+            break;
+        }
+        case ValueType::Float:
+            value = result.quantity.getValue();
+            break;
+        case ValueType::Quantity:
+            value = result.quantity;
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_COMPILEDEXPRESSION_H
+#define APP_COMPILEDEXPRESSION_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <App/ObjectIdentifier.h>
+#include <Base/Quantity.h>
+
+namespace App
+{
+
+class Expression;
+
+/**
+ * The CompiledExpression class is a flat, stack based representation of a
+ * numeric expression.
+ *
+ * Only expressions made of numbers, units, the arithmetic operators +, -, *,
+ * / and references to plain integer, float or quantity properties can be
+ * compiled. Evaluating them doesn't allocate memory and doesn't need the
+ * Python interpreter. The result has the same type as the one returned by
+ * Expression::getValueAsAny(), i.e. long, double or Base::Quantity.
+ */
+class AppExport CompiledExpression
+{
+public:
+    /// Compiles \a expr, returns null if the expression is not supported
+    static std::unique_ptr<CompiledExpression> compile(const Expression* expr);
+
+    /** Evaluates the expression.
+     * Returns false if the expression cannot be evaluated here, e.g. because
+     * a property has a type that is not supported or because an error occurred.
+     * The caller must then evaluate the original expression which reports the
+     * error the usual way.
+     */
+    bool eval(App::any& value) const;
+
+private:
+    CompiledExpression() = default;
+
+    enum class OpCode : uint8_t
+    {
+        Constant,
+        Variable,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Neg,
+    };
+
+    // Mimics the Python type the value has when evaluating the expression tree
+    enum class ValueType : uint8_t
+    {
+        Integer,
+        Float,
+        Quantity,
+    };
+
+    struct Value
+    {
+        Base::Quantity quantity;
+        ValueType type {ValueType::Float};
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        uint32_t index;
+    };
+
+    bool compileNode(const Expression* expr, int depth);
+    bool getVariable(const ObjectIdentifier& var, Value& value) const;
+    static bool calc(OpCode op, Value& left, const Value& right);
+
+    static constexpr int MaxStackSize = 32;
+
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::vector<ObjectIdentifier> variables;
+};
+
+}  // namespace App
+
+#endif  // APP_COMPILEDEXPRESSION_H
@@ -27,7 +27,9 @@
 #include "PreCompiled.h"  // NOLINT
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
 #endif
 
 #include <boost/regex.hpp>
@@ -631,8 +633,10 @@ unsigned int ComplexGeoData::getMemSize() const
 {
     flushElementMap();
     if (_elementMap) {
-        static const int multiplier {10};
-        return _elementMap->size() * multiplier;
+        // saturate instead of wrapping around for huge maps
+        unsigned long memSize = _elementMap->getMemSize();
+        return static_cast<unsigned int>(
+            std::min<unsigned long>(memSize, std::numeric_limits<unsigned int>::max()));
     }
     return 0;
 }
@@ -76,6 +76,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 
 #include <boost/regex.hpp>
 #include <random>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -99,6 +100,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include "private/DocumentP.h"
 #include "Application.h"
 #include "AutoTransaction.h"
+#include "NotificationBatch.h"
 #include "ExpressionParser.h"
 #include "GeoFeature.h"
 #include "License.h"
@@ -162,6 +164,129 @@ DocumentP::DocumentP()
     UndoMaxStackSize = 20;
 }
 
+bool UniqueNameIndex::splitName(const std::string& name, std::string& base, std::string& suffix)
+{
+    // same as Base::unique_name::removeDigitsFromEnd()
+    std::string::size_type pos = name.find_last_not_of("0123456789");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    base = name.substr(0, pos + 1);
+    suffix = name.substr(pos + 1);
+    return true;
+}
+
+void UniqueNameIndex::add(const std::string& name)
+{
+    names[name]++;
+    std::string base, suffix;
+    if (splitName(name, base, suffix) && !suffix.empty()) {
+        suffixes[base][suffix]++;
+    }
+}
+
+void UniqueNameIndex::remove(const std::string& name)
+{
+    auto it = names.find(name);
+    if (it == names.end()) {
+        return;
+    }
+    if (--it->second == 0) {
+        names.erase(it);
+    }
+
+    std::string base, suffix;
+    if (splitName(name, base, suffix) && !suffix.empty()) {
+        auto jt = suffixes.find(base);
+        if (jt != suffixes.end()) {
+            auto kt = jt->second.find(suffix);
+            if (kt != jt->second.end() && --kt->second == 0) {
+                jt->second.erase(kt);
+            }
+            if (jt->second.empty()) {
+                suffixes.erase(jt);
+            }
+        }
+    }
+}
+
+void UniqueNameIndex::clear()
+{
+    names.clear();
+    suffixes.clear();
+}
+
+bool UniqueNameIndex::contains(const std::string& name) const
+{
+    return names.find(name) != names.end();
+}
+
+int UniqueNameIndex::count(const std::string& name) const
+{
+    auto it = names.find(name);
+    return it != names.end() ? it->second : 0;
+}
+
+std::string UniqueNameIndex::getUniqueName(const std::string& name,
+                                           int pad,
+                                           const std::string* exclude) const
+{
+    if (exclude && !contains(*exclude)) {
+        exclude = nullptr;
+    }
+
+    std::string base, numSuffix;
+    if (!splitName(name, base, numSuffix)) {
+        // a name made of digits only is the prefix of names with a different base
+        std::vector<std::string> all;
+        all.reserve(names.size());
+        for (const auto& it : names) {
+            int count = it.second;
+            if (exclude && it.first == *exclude) {
+                --count;
+                exclude = nullptr;
+            }
+            if (count > 0) {
+                all.push_back(it.first);
+            }
+        }
+        return Base::Tools::getUniqueName(name, all, pad);
+    }
+
+    std::size_t numNames = 0;
+    for (const auto& it : names) {
+        numNames += it.second;
+        if (numNames > 1) {
+            break;
+        }
+    }
+    if (numNames == 0 || (numNames == 1 && exclude)) {
+        return name;
+    }
+
+    std::string exBase, exSuffix;
+    if (exclude && !(splitName(*exclude, exBase, exSuffix) && exBase == base)) {
+        exclude = nullptr;
+    }
+
+    auto it = suffixes.find(base);
+    if (it != suffixes.end()) {
+        for (auto jt = it->second.rbegin(); jt != it->second.rend(); ++jt) {
+            if (exclude && jt->first == exSuffix && jt->second == 1) {
+                continue;
+            }
+            if (SuffixLess()(numSuffix, jt->first)) {
+                numSuffix = jt->first;
+            }
+            break;
+        }
+    }
+
+    // Let Base::Tools::getUniqueName() append the increased suffix so that the format is the same
+    std::string highest = base + numSuffix;
+    return Base::Tools::getUniqueName(highest, {highest}, pad);
+}
+
 } // namespace App
 
 PROPERTY_SOURCE(App::Document, App::PropertyContainer)
@@ -602,6 +727,7 @@ void Document::clearDocument()
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearNameIndex();
     d->lastObjectId = 0;
 }
 
@@ -773,6 +899,15 @@ void Document::onBeforeChangeProperty(const TransactionalObject *Who, const Prop
 void Document::onChangedProperty(const DocumentObject *Who, const Property *What)
 {
     signalChangedObject(*Who, *What);
+    NotificationBatch::notifyChange(*Who, *What);
+}
+
+void Document::onChangedLabel(const DocumentObject *Who)
+{
+    // removed objects kept for undo are not indexed
+    auto it = d->objectIdMap.find(Who->getID());
+    if (it != d->objectIdMap.end() && it->second == Who)
+        d->indexLabel(Who, Who->Label.getStrValue());
 }
 
 void Document::setTransactionMode(int iMode)
@@ -1547,6 +1682,21 @@ unsigned int Document::getMemSize () const
     return size;
 }
 
+Document::SubObjectCacheStats Document::getSubObjectCacheStats(bool reset) const
+{
+    auto &cache = d->subObjectCache;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    SubObjectCacheStats stats;
+    stats.hits = cache.hits;
+    stats.misses = cache.misses;
+    stats.entries = cache.entries.size();
+    if (reset) {
+        cache.hits = 0;
+        cache.misses = 0;
+    }
+    return stats;
+}
+
 static std::string checkFileName(const char *file) {
     std::string fn(file);
 
@@ -2055,6 +2205,7 @@ void Document::restore (const char *filename,
     d->objectArray.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearNameIndex();
     d->lastObjectId = 0;
 
     if(signal) {
@@ -2079,6 +2230,12 @@ void Document::restore (const char *filename,
     if (!reader.isValid())
         throw Base::FileException("Error reading compression file",filename);
 
+    // Tokenize Document.xml on a background thread while the objects are restored
+    if (std::thread::hardware_concurrency() > 1
+            && App::GetApplication().GetParameterGroupByPath(
+                "User parameter:BaseApp/Preferences/Document")->GetBool("ConcurrentXMLParsing", true))
+        reader.startConcurrentParsing();
+
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
 
@@ -2091,6 +2248,8 @@ void Document::restore (const char *filename,
         Base::Console().Error("Invalid Document.xml: %s\n", e.what());
         setStatus(Document::RestoreError, true);
     }
+    // the parser thread must not read from the zip stream any more
+    reader.stopConcurrentParsing();
 
     d->partialLoadObjects.clear();
     d->programVersion = reader.ProgramVersion;
@@ -3232,6 +3391,8 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
+    d->objectNames.add(ObjectName);
+    d->indexLabel(pcObject, pcObject->Label.getStrValue());
     // generate object id and add to id map;
     pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3293,13 +3454,6 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         return objects;
     }
 
-    // get all existing object names
-    std::vector<std::string> reservedNames;
-    reservedNames.reserve(d->objectMap.size());
-    for (const auto & pos : d->objectMap) {
-        reservedNames.push_back(pos.first);
-    }
-
     for (auto it = objects.begin(); it != objects.end(); ++it) {
         auto index = std::distance(objects.begin(), it);
         App::DocumentObject* pcObject = *it;
@@ -3329,13 +3483,13 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
                 }
             }
 
-            ObjectName = Base::Tools::getUniqueName(ObjectName, reservedNames, 3);
+            ObjectName = d->objectNames.getUniqueName(ObjectName, 3);
         }
 
-        reservedNames.push_back(ObjectName);
-
         // insert in the name map
         d->objectMap[ObjectName] = pcObject;
+        d->objectNames.add(ObjectName);
+        d->indexLabel(pcObject, pcObject->Label.getStrValue());
         // generate object id and add to id map;
         pcObject->_Id = ++d->lastObjectId;
         d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3400,6 +3554,8 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
+    d->objectNames.add(ObjectName);
+    d->indexLabel(pcObject, pcObject->Label.getStrValue());
     // generate object id and add to id map;
     if(!pcObject->_Id) pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3430,6 +3586,8 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
 {
     std::string ObjectName = getUniqueObjectName(pObjectName);
     d->objectMap[ObjectName] = pcObject;
+    d->objectNames.add(ObjectName);
+    d->indexLabel(pcObject, pcObject->Label.getStrValue());
     // generate object id and add to id map;
     if(!pcObject->_Id) pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
@@ -3554,6 +3712,8 @@ void Document::removeObject(const char* sName)
     if (tobedestroyed) {
         tobedestroyed->pcNameInDocument = nullptr;
     }
+    d->objectNames.remove(pos->first);
+    d->unindexLabel(pos->second);
     d->objectMap.erase(pos);
 }
 
@@ -3618,6 +3778,8 @@ void Document::_removeObject(DocumentObject* pcObject)
     // remove from map
     pcObject->setStatus(ObjectStatus::Remove, false); // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
+    d->objectNames.remove(pos->first);
+    d->unindexLabel(pcObject);
     d->objectMap.erase(pos);
 
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
@@ -3893,26 +4055,37 @@ std::string Document::getUniqueObjectName(const char *Name) const
             }
         }
 
-        std::vector<std::string> names;
-        names.reserve(d->objectMap.size());
-        for (pos = d->objectMap.begin();pos != d->objectMap.end();++pos) {
-            names.push_back(pos->first);
-        }
-        return Base::Tools::getUniqueName(CleanName, names, 3);
+        return d->objectNames.getUniqueName(CleanName, 3);
     }
 }
 
 std::string Document::getStandardObjectName(const char *Name, int d) const
 {
-    std::vector<App::DocumentObject*> mm = getObjects();
-    std::vector<std::string> labels;
-    labels.reserve(mm.size());
+    return this->d->objectLabels.getUniqueName(Name, d);
+}
+
+bool Document::containsObjectLabel(const std::string& label, const DocumentObject* exclude) const
+{
+    int count = d->objectLabels.count(label);
+    if (count > 0 && exclude) {
+        auto it = d->indexedLabels.find(exclude);
+        if (it != d->indexedLabels.end() && it->second == label)
+            --count;
+    }
+    return count > 0;
+}
 
-    for (auto it : mm) {
-        std::string label = it->Label.getValue();
-        labels.push_back(label);
+std::string Document::getUniqueObjectLabel(const std::string& label,
+                                           const DocumentObject* exclude,
+                                           int d) const
+{
+    const std::string* excludeLabel = nullptr;
+    if (exclude) {
+        auto it = this->d->indexedLabels.find(exclude);
+        if (it != this->d->indexedLabels.end())
+            excludeLabel = &it->second;
     }
-    return Base::Tools::getUniqueName(Name, labels, d);
+    return this->d->objectLabels.getUniqueName(label, d, excludeLabel);
 }
 
 std::vector<DocumentObject*> Document::getDependingObjects() const
@@ -244,6 +244,15 @@ public:
     /// returns the complete document memory consumption, including all managed DocObjects and Undo Redo.
     unsigned int getMemSize () const override;
 
+    /// Statistics of the sub object cache, see DocumentObject::getSubObjectCached()
+    struct SubObjectCacheStats {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t entries = 0;
+    };
+    /// Returns the statistics of the sub object cache and optionally resets the counters
+    SubObjectCacheStats getSubObjectCacheStats(bool reset=false) const;
+
     /** @name Object handling  */
     //@{
     /** Add a feature of sType with sName (ASCII) to this document and set it active.
@@ -310,6 +319,14 @@ public:
     std::string getUniqueObjectName(const char *Name) const;
     /// Returns a name of the form prefix_number. d specifies the number of digits.
     std::string getStandardObjectName(const char *Name, int d) const;
+    /// Checks if an object other than \a exclude has the given label
+    bool containsObjectLabel(const std::string& label, const DocumentObject* exclude = nullptr) const;
+    /** Returns a unique label of the form prefix_number like getStandardObjectName() but
+     * ignores the label of \a exclude. d specifies the number of digits.
+     */
+    std::string getUniqueObjectLabel(const std::string& label,
+                                     const DocumentObject* exclude,
+                                     int d) const;
     /// Returns a list of document's objects including the dependencies
     std::vector<DocumentObject*> getDependingObjects() const;
     /// Returns a list of all Objects
@@ -562,6 +579,8 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject *Who, const Property *What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject *Who, const Property *What);
+    /// callback from the Document objects after the label was changed
+    void onChangedLabel(const DocumentObject *Who);
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
@@ -24,6 +24,8 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <atomic>
+#include <mutex>
 #include <stack>
 #endif
 
@@ -40,15 +42,26 @@
 #include "DocumentObjectExtension.h"
 #include "DocumentObjectGroup.h"
 #include "GeoFeatureGroupExtension.h"
+#include "Link.h"
 #include "ObjectIdentifier.h"
+#include "OriginFeature.h"
 #include "PropertyExpressionEngine.h"
+#include "PropertyGeo.h"
 #include "PropertyLinks.h"
+#include "private/DocumentP.h"
 
 
 FC_LOG_LEVEL_INIT("App",true,true)
 
 using namespace App;
 
+namespace {
+// Incremented on every change that may alter the result of getSubObject()
+std::atomic<unsigned long> subObjectCacheGeneration {1};
+// Maximum number of cached sub objects per document
+const std::size_t subObjectCacheLimit = 10000;
+}
+
 /** \defgroup DocObject Document Object
     \ingroup APP
     \brief Base class of all objects handled in the Document
@@ -94,6 +107,7 @@ DocumentObject::~DocumentObject()
         // Call before decrementing the reference counter, otherwise a heap error can occur
         obj->setInvalid();
     }
+    clearSubObjectCache();
 }
 
 void DocumentObject::printInvalidLinks() const
@@ -367,6 +381,7 @@ const char* DocumentObject::detachFromDocument()
 {
     const std::string* name = pcNameInDocument;
     pcNameInDocument = nullptr;
+    clearSubObjectCache();
     return name ? name->c_str() : nullptr;
 }
 
@@ -692,6 +707,7 @@ App::Document *DocumentObject::getDocument() const
 void DocumentObject::setDocument(App::Document* doc)
 {
     _pDoc=doc;
+    clearSubObjectCache();
     onSettingDocument();
 }
 
@@ -722,6 +738,7 @@ bool DocumentObject::removeDynamicProperty(const char* name)
         ExpressionEngine.setValue(it, std::shared_ptr<Expression>());
     }
 
+    clearSubObjectCache();
     return TransactionalObject::removeDynamicProperty(name);
 }
 
@@ -732,6 +749,8 @@ App::Property* DocumentObject::addDynamicProperty(
     auto prop = TransactionalObject::addDynamicProperty(type,name,group,doc,attr,ro,hidden);
     if(prop && _pDoc)
         _pDoc->addOrRemovePropertyOfObject(this, prop, true);
+    if(prop)
+        clearSubObjectCache();
     return prop;
 }
 
@@ -772,6 +791,10 @@ void DocumentObject::onEarlyChange(const Property *prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    // keep the label index of the document up to date even if the object is frozen
+    if (prop == &Label && _pDoc)
+        _pDoc->onChangedLabel(this);
+
     if (isFreezed())
         return;
 
@@ -896,7 +919,7 @@ std::vector<DocumentObject*> DocumentObject::getSubObjectList(const char *subnam
     for(auto pos=sub.find('.');pos!=std::string::npos;pos=sub.find('.',pos+1)) {
         char c = sub[pos+1];
         sub[pos+1] = 0;
-        auto sobj = getSubObject(sub.c_str());
+        auto sobj = getSubObjectCached(sub.c_str());
         if(!sobj || !sobj->isAttachedToDocument())
             break;
         res.push_back(sobj);
@@ -905,6 +928,79 @@ std::vector<DocumentObject*> DocumentObject::getSubObjectList(const char *subnam
     return res;
 }
 
+void DocumentObject::clearSubObjectCache()
+{
+    ++subObjectCacheGeneration;
+}
+
+void DocumentObject::invalidateSubObjectCache(const Property *prop) const
+{
+    if(prop == &Label
+            || prop->isDerivedFrom(PropertyLinkBase::getClassTypeId())
+            || prop->isDerivedFrom(PropertyPlacement::getClassTypeId()))
+    {
+        clearSubObjectCache();
+        return;
+    }
+    // e.g. LinkTransform, ElementCount and Scale
+    if(auto ext = getExtensionByType<LinkBaseExtension>(true)) {
+        for(const auto &info : ext->getPropertyInfo()) {
+            if(ext->getProperty(info.index) == prop) {
+                clearSubObjectCache();
+                return;
+            }
+        }
+    }
+    // origin features are looked up by role
+    if(isDerivedFrom(OriginFeature::getClassTypeId())
+            && prop == &static_cast<const OriginFeature*>(this)->Role)
+        clearSubObjectCache();
+}
+
+DocumentObject *DocumentObject::getSubObjectCached(const char *subname,
+        Base::Matrix4D *mat, bool transform) const
+{
+    if(!_pDoc || !isAttachedToDocument())
+        return getSubObject(subname,nullptr,mat,transform);
+
+    auto &cache = _pDoc->d->subObjectCache;
+    SubObjectCache::Key key{getID(), transform, subname?subname:""};
+    unsigned long generation = subObjectCacheGeneration;
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if(cache.generation != generation) {
+            cache.entries.clear();
+            cache.generation = generation;
+        }
+        auto it = cache.entries.find(key);
+        if(it != cache.entries.end()) {
+            ++cache.hits;
+            if(mat)
+                *mat *= it->second.mat;
+            return it->second.obj;
+        }
+        ++cache.misses;
+    }
+
+    // getSubObject() multiplies all transformations from the right, so the
+    // relative one can be obtained by starting with an identity matrix and
+    // later be applied to any input matrix.
+    Base::Matrix4D relative;
+    auto ret = getSubObject(subname,nullptr,&relative,transform);
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        // do not store the result if anything has changed in the meantime
+        if(cache.generation == generation && subObjectCacheGeneration == generation) {
+            if(cache.entries.size() >= subObjectCacheLimit)
+                cache.entries.clear();
+            cache.entries.emplace(std::move(key),SubObjectCache::Entry{ret,relative});
+        }
+    }
+    if(mat)
+        *mat *= relative;
+    return ret;
+}
+
 std::vector<std::string> DocumentObject::getSubObjects(int reason) const {
     std::vector<std::string> ret;
     auto exts = getExtensionsDerivedFromType<App::DocumentObjectExtension>();
@@ -933,7 +1029,7 @@ std::vector<std::pair<App::DocumentObject *,std::string>> DocumentObject::getPar
             continue;
         }
 
-        if (!parent->getSubObject(name.c_str())) {
+        if (!parent->getSubObjectCached(name.c_str())) {
             continue;
         }
 
@@ -1140,7 +1236,11 @@ DocumentObject *DocumentObject::resolve(const char *subname,
     if(parent) *parent = nullptr;
     if(subElement) *subElement = nullptr;
 
-    auto obj = getSubObject(subname,pyObj,pmat,transform,depth);
+    DocumentObject *obj;
+    if(!pyObj && !depth)
+        obj = getSubObjectCached(subname,pmat,transform);
+    else
+        obj = getSubObject(subname,pyObj,pmat,transform,depth);
     if(!obj || !subname || *subname==0)
         return self;
 
@@ -1185,7 +1285,7 @@ DocumentObject *DocumentObject::resolve(const char *subname,
             }
             if(dot==subname)
                 break;
-            auto sobj = getSubObject(std::string(subname,dot-subname+1).c_str());
+            auto sobj = getSubObjectCached(std::string(subname,dot-subname+1).c_str());
             if(sobj!=obj) {
                 if(parent) {
                     // Link/LinkGroup has special visibility handling of plain
@@ -1196,7 +1296,7 @@ DocumentObject *DocumentObject::resolve(const char *subname,
                     }
                     for(auto ddot=dot-1;ddot!=subname;--ddot) {
                         if(*ddot != '.') continue;
-                        auto sobj = getSubObject(std::string(subname,ddot-subname+1).c_str());
+                        auto sobj = getSubObjectCached(std::string(subname,ddot-subname+1).c_str());
                         if(!sobj->hasExtension(GroupExtension::getExtensionClassTypeId(),false)) {
                             *parent = sobj;
                             break;
@@ -1232,8 +1332,8 @@ DocumentObject *DocumentObject::resolveRelativeLink(std::string &subname,
             std::string subcheck(sub,nextsub-sub);
             subcheck += link->getNameInDocument();
             subcheck += '.';
-            if(getSubObject(subcheck.c_str())==link) {
-                ret = getSubObject(std::string(sub,dot+1-sub).c_str());
+            if(getSubObjectCached(subcheck.c_str())==link) {
+                ret = getSubObjectCached(std::string(sub,dot+1-sub).c_str());
                 if(!ret) 
                     return nullptr;
                 subname = std::string(dot+1);
@@ -1262,7 +1362,7 @@ DocumentObject *DocumentObject::resolveRelativeLink(std::string &subname,
     }while(subname.compare(0,pos,linkSub,0,linkPos)==0);
 
     if(pos != std::string::npos) {
-        ret = getSubObject(subname.substr(0,pos).c_str());
+        ret = getSubObjectCached(subname.substr(0,pos).c_str());
         if(!ret) {
             link = nullptr;
             return nullptr;
@@ -1270,7 +1370,7 @@ DocumentObject *DocumentObject::resolveRelativeLink(std::string &subname,
         subname = subname.substr(pos);
     }
     if(linkPos) {
-        link = link->getSubObject(linkSub.substr(0,linkPos).c_str());
+        link = link->getSubObjectCached(linkSub.substr(0,linkPos).c_str());
         if(!link)
             return nullptr;
         linkSub = linkSub.substr(linkPos);
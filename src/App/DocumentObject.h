@@ -366,6 +366,31 @@ public:
     /// Return a list of objects referenced by a given subname including this object
     std::vector<DocumentObject*> getSubObjectList(const char *subname) const;
 
+    /** Memoized getSubObject() without the python object
+     *
+     * The resolved object and the transformation of \c subname are cached in
+     * the document of this object and reused until a property that may alter
+     * the result is changed (see invalidateSubObjectCache()), or an object is
+     * added to or removed from a document. It returns the same as
+     * getSubObject(subname,nullptr,mat,transform).
+     *
+     * @sa getSubObject(), Document::getSubObjectCacheStats()
+     */
+    DocumentObject *getSubObjectCached(const char *subname,
+            Base::Matrix4D *mat=nullptr, bool transform=true) const;
+
+    /// Invalidate the cached sub objects of all documents
+    static void clearSubObjectCache();
+
+    /** Invalidate the cached sub objects if the change of a property of this
+     * object may alter the result of getSubObject()
+     *
+     * These are the link, placement and link extension properties, which
+     * includes any change of the in-list and the group, and the label used by
+     * subname paths like '$Label.'.
+     */
+    void invalidateSubObjectCache(const Property *prop) const;
+
     /// reason of calling getSubObjects()
     enum GSReason {
         /// default, mostly for exporting shape objects
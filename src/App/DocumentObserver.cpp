@@ -387,7 +387,7 @@ std::string SubObjectT::getOldElementName(int *index) const {
 App::DocumentObject *SubObjectT::getSubObject() const {
     auto obj = getObject();
     if(obj)
-        return obj->getSubObject(subname.c_str());
+        return obj->getSubObjectCached(subname.c_str());
     return nullptr;
 }
 
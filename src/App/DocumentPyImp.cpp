@@ -964,6 +964,20 @@ PyObject *DocumentPy::getDependentDocuments(PyObject *args) {
     } PY_CATCH;
 }
 
+PyObject *DocumentPy::getSubObjectCacheStats(PyObject *args) {
+    PyObject *reset = Py_False;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &reset))
+        return nullptr;
+    PY_TRY {
+        auto stats = getDocumentPtr()->getSubObjectCacheStats(Base::asBoolean(reset));
+        Py::Dict dict;
+        dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+        dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+        dict.setItem("Entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+        return Py::new_reference_to(dict);
+    } PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getRestoring() const
 {
     return {getDocumentPtr()->testStatus(Document::Status::Restoring)};
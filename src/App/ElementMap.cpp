@@ -1,5 +1,8 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -311,7 +314,8 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
             FC_THROWM(Base::RuntimeError, "missing element child count");// NOLINT
         }
 
-        auto& indices = this->indexedNames[idx.getType()];
+        auto& entry = *this->indexedNames.try_emplace(idx.getType()).first;
+        auto& indices = entry.second;
         for (int j = 0; j < outerCount; ++j) {
             int cIndex = 0;
             int offset = 0;
@@ -378,6 +382,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
         stream >> std::hex;
 
         indices.names.resize(outerCount);
+        this->mappedNames.reserve(this->mappedNames.size() + outerCount);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
             auto* ref = &indices.names[j];
@@ -440,7 +445,9 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef, std::istream
                     }
                 }
 
-                this->mappedNames.emplace(ref->name, idx);
+                if (!this->mappedNames.find(ref->name)) {
+                    this->mappedNames.insert(ref->name, entry, j);
+                }
 
                 if (!hasherRef) {
                     if (offset + 1 < (int)tokens.size()) {
@@ -504,25 +511,28 @@ MappedName ElementMap::addName(MappedName& name, const IndexedName& idx, const E
         if (overwrite) {
             erase(idx);
         }
-        auto ret = mappedNames.insert(std::make_pair(name, idx));
-        if (ret.second) {              // element just inserted did not exist yet in the map
-            ret.first->first.compact();// FIXME see MappedName.cpp
-            mappedRef(idx).append(ret.first->first, sids);
+        const MappedNameRef* ref = nullptr;
+        IndexedName found = mappedNames.find(name, &ref);
+        if (!found) {// element did not exist yet in the map
+            MappedName stored(name);
+            stored.compact();// FIXME see MappedName.cpp
+            mappedRef(idx).append(stored, sids);
+            mappedNames.insert(stored, *this->indexedNames.find(idx.getType()), idx.getIndex());
             FC_TRACE(idx << " -> " << name);// NOLINT
-            return ret.first->first;
+            return stored;
         }
-        if (ret.first->second == idx) {
+        if (found == idx) {
             FC_TRACE("duplicate " << idx << " -> " << name);// NOLINT
-            return ret.first->first;
+            return ref->name;
         }
         if (!overwrite) {
             if (existing) {
-                *existing = ret.first->second;
+                *existing = found;
             }
             return {};
         }
 
-        erase(ret.first->first);
+        erase(MappedName(ref->name));
     };
 }
 
@@ -759,16 +769,16 @@ MappedName ElementMap::renameDuplicateElement(int index, const IndexedName& elem
 
 void ElementMap::erase(const MappedName& name)
 {
-    auto it = this->mappedNames.find(name);
-    if (it == this->mappedNames.end()) {
+    IndexedName idx = this->mappedNames.find(name);
+    if (!idx) {
         return;
     }
-    MappedNameRef* ref = findMappedRef(it->second);
+    MappedNameRef* ref = findMappedRef(idx);
     if (!ref) {
         return;
     }
+    this->mappedNames.erase(name);
     ref->erase(name);
-    this->mappedNames.erase(it);
 }
 
 void ElementMap::erase(const IndexedName& idx)
@@ -798,10 +808,173 @@ bool ElementMap::empty() const
     return mappedNames.empty() && childElementSize == 0;
 }
 
+unsigned long ElementMap::getMemSize() const
+{
+    // The names are only stored in the name references, the hash index refers to them
+    unsigned long memSize = sizeof(ElementMap);
+    memSize += mappedNames.getMemSize();
+    for (const auto& indexedName : this->indexedNames) {
+        memSize += sizeof(indexedName) + 3 * sizeof(void*);
+        memSize += indexedName.second.names.capacity() * sizeof(MappedNameRef);
+        memSize += indexedName.second.children.size()
+            * (sizeof(std::pair<const int, MappedChildElements>) + 3 * sizeof(void*));
+        for (const auto& mappedNameRef : indexedName.second.names) {
+            for (auto ref = &mappedNameRef; ref; ref = ref->next.get()) {
+                if (ref != &mappedNameRef) {
+                    memSize += sizeof(MappedNameRef);
+                }
+                memSize += ref->name.dataBytes().capacity() + ref->name.postfixBytes().capacity();
+                memSize += ref->sids.capacity() * sizeof(App::StringIDRef);
+            }
+        }
+    }
+    return memSize;
+}
+
+namespace
+{
+// a slot that was used, so the probing must continue
+constexpr int deletedIndex = -1;
+constexpr std::size_t noSlot = std::numeric_limits<std::size_t>::max();
+constexpr std::size_t minSlotCount = 16;
+}// namespace
+
+std::uint32_t ElementMap::MappedNameIndex::hashName(const MappedName& name)
+{
+    // FNV-1a
+    std::uint32_t hash = 2166136261U;
+    auto combine = [&hash](const QByteArray& bytes) {
+        for (char byte : bytes) {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 16777619U;
+        }
+    };
+    combine(name.dataBytes());
+    combine(name.postfixBytes());
+    return hash;
+}
+
+std::size_t ElementMap::MappedNameIndex::findSlot(const MappedName& name,
+                                                  std::uint32_t hash,
+                                                  const MappedNameRef** ref) const
+{
+    if (count == 0) {
+        return noSlot;
+    }
+    // there is always at least one empty slot
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+        const Slot& slot = slots[pos];
+        if (!slot.entry) {
+            if (slot.index != deletedIndex) {
+                return noSlot;
+            }
+            continue;
+        }
+        if (slot.hash != hash) {
+            continue;
+        }
+        const auto& names = slot.entry->second.names;
+        if (slot.index >= static_cast<int>(names.size())) {
+            continue;
+        }
+        for (auto nameRef = &names[slot.index]; nameRef; nameRef = nameRef->next.get()) {
+            if (nameRef->name == name) {
+                if (ref) {
+                    *ref = nameRef;
+                }
+                return pos;
+            }
+        }
+    }
+}
+
+IndexedName ElementMap::MappedNameIndex::find(const MappedName& name,
+                                              const MappedNameRef** ref) const
+{
+    std::size_t pos = findSlot(name, hashName(name), ref);
+    if (pos == noSlot) {
+        return IndexedName();
+    }
+    return IndexedName::fromConst(slots[pos].entry->first, slots[pos].index);
+}
+
+void ElementMap::MappedNameIndex::insert(const MappedName& name,
+                                         const IndexedEntry& entry,
+                                         int index)
+{
+    // keep the load factor including deleted slots below 3/4
+    if ((count + deleted + 1) * 4 > slots.size() * 3) {
+        rehash(count + 1);
+    }
+    std::uint32_t hash = hashName(name);
+    std::size_t mask = slots.size() - 1;
+    std::size_t pos = hash & mask;
+    while (slots[pos].entry) {
+        pos = (pos + 1) & mask;
+    }
+    if (slots[pos].index == deletedIndex) {
+        --deleted;
+    }
+    slots[pos].entry = &entry;
+    slots[pos].index = index;
+    slots[pos].hash = hash;
+    ++count;
+}
+
+void ElementMap::MappedNameIndex::erase(const MappedName& name)
+{
+    std::size_t pos = findSlot(name, hashName(name), nullptr);
+    if (pos == noSlot) {
+        return;
+    }
+    slots[pos] = Slot();
+    slots[pos].index = deletedIndex;
+    --count;
+    ++deleted;
+}
+
+void ElementMap::MappedNameIndex::reserve(std::size_t minCount)
+{
+    if (minCount * 4 > slots.size() * 3) {
+        rehash(minCount);
+    }
+}
+
+void ElementMap::MappedNameIndex::rehash(std::size_t minCount)
+{
+    // a power of two with a load factor of at most 1/2 after rehashing
+    std::size_t slotCount = minSlotCount;
+    while (slotCount < 2 * std::max(minCount, count)) {
+        slotCount *= 2;
+    }
+
+    std::vector<Slot> oldSlots(slotCount);
+    oldSlots.swap(slots);
+    deleted = 0;
+    std::size_t mask = slots.size() - 1;
+    for (const auto& slot : oldSlots) {
+        if (!slot.entry) {
+            continue;
+        }
+        std::size_t pos = slot.hash & mask;
+        while (slots[pos].entry) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = slot;
+    }
+}
+
+std::size_t ElementMap::MappedNameIndex::getMemSize() const
+{
+    return slots.capacity() * sizeof(Slot);
+}
+
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
-    auto nameIter = mappedNames.find(name);
-    if (nameIter == mappedNames.end()) {
+    const MappedNameRef* ref = nullptr;
+    IndexedName found = mappedNames.find(name, &ref);
+    if (!found) {
         if (childElements.isEmpty()) {
             return IndexedName();
         }
@@ -838,20 +1011,14 @@ IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
     }
 
     if (sids) {
-        const MappedNameRef* ref = findMappedRef(nameIter->second);
-        for (; ref; ref = ref->next.get()) {
-            if (ref->name == name) {
-                if (sids->empty()) {
-                    *sids = ref->sids;
-                }
-                else {
-                    *sids += ref->sids;
-                }
-                break;
-            }
+        if (sids->empty()) {
+            *sids = ref->sids;
+        }
+        else {
+            *sids += ref->sids;
         }
     }
-    return nameIter->second;
+    return found;
 }
 
 MappedName ElementMap::find(const IndexedName& idx, ElementIDRefs* sids) const
@@ -1047,8 +1214,14 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // Walk the names by element instead of the hash index to keep the saved postfix
+    // order deterministic
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& mappedNameRef : indexedName.second.names) {
+            for (auto ref = &mappedNameRef; ref; ref = ref->next.get()) {
+                addPostfix(ref->name.postfixBytes(), postfixMap, postfixes);
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1268,9 +1441,22 @@ std::vector<MappedElement> ElementMap::getAll() const
 {
     std::vector<MappedElement> ret;
     ret.reserve(size());
-    for (auto& mappedName : this->mappedNames) {
-        ret.emplace_back(mappedName.first, mappedName.second);
+    for (auto& indexedName : this->indexedNames) {
+        int index = 0;
+        for (auto& mappedNameRef : indexedName.second.names) {
+            IndexedName idx = IndexedName::fromConst(indexedName.first, index++);
+            for (auto ref = &mappedNameRef; ref; ref = ref->next.get()) {
+                // a name may fail to be indexed when restoring a broken map
+                if (ref->name && mappedNames.find(ref->name) == idx) {
+                    ret.emplace_back(ref->name, idx);
+                }
+            }
+        }
     }
+    // sort to keep returning the names in ascending order
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& left, const MappedElement& right) {
+        return left.name < right.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
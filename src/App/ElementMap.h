@@ -33,10 +33,11 @@
 #include "StringHasher.h"
 
 #include <cstring>
-#include <deque>
 #include <functional>
 #include <map>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -63,10 +64,11 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
 /* This class provides for ComplexGeoData's ability to provide proper naming.
  * Specifically, ComplexGeoData uses this class for it's `_id` property.
  * Most of the operations work with the `indexedNames` and `mappedNames` maps.
- * `indexedNames` maps a string to both a name queue and children.
+ * `indexedNames` maps a string to both a name vector and children.
  *   each of those children store an IndexedName, offset details, postfix, ids, and
  *   possibly a recursive elementmap
- * `mappedNames` maps a MappedName to a specific IndexedName.
+ * `mappedNames` is a hash index mapping a MappedName to a specific IndexedName. It
+ *   does not store the names, but refers to the names of `indexedNames`.
  */
 class AppExport ElementMap: public std::enable_shared_from_this<ElementMap> //TODO can remove shared_from_this?
 {
@@ -151,6 +153,9 @@ public:
 
     bool empty() const;
 
+    /// Approximate memory in bytes used by this map, excluding child element maps
+    unsigned long getMemSize() const;
+
     IndexedName find(const MappedName& name, ElementIDRefs* sids = nullptr) const;
 
     MappedName find(const IndexedName& idx, ElementIDRefs* sids = nullptr) const;
@@ -285,13 +290,67 @@ private:
 
     struct IndexedElements
     {
-        std::deque<MappedNameRef> names;
+        std::vector<MappedNameRef> names;
         std::map<int, MappedChildElements> children;
     };
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    using IndexedEntry = std::pair<const char* const, IndexedElements>;
+
+    /* Open addressing hash index from a MappedName to the element it is mapped to. A slot
+     * only refers to the type entry of `indexedNames` and the index of the element, the
+     * name itself is looked up in the names of the element.
+     * MappedName considers two names equal no matter where the data ends and the postfix
+     * starts, so the hash is computed over the concatenated content.
+     */
+    class MappedNameIndex
+    {
+    public:
+        MappedNameIndex() = default;
+        // the slots refer to the entries of the owning map
+        MappedNameIndex(const MappedNameIndex&) = delete;
+        MappedNameIndex& operator=(const MappedNameIndex&) = delete;
+
+        /// Returns the element \c name is mapped to and optionally its name reference
+        IndexedName find(const MappedName& name, const MappedNameRef** ref = nullptr) const;
+        /** Adds \c name, which must not be in the index yet and must already be
+         * stored in the names of the element \c index of \c entry
+         */
+        void insert(const MappedName& name, const IndexedEntry& entry, int index);
+        /// Removes \c name, must be called before it is removed from the names of its element
+        void erase(const MappedName& name);
+        void reserve(std::size_t count);
+        std::size_t size() const
+        {
+            return count;
+        }
+        bool empty() const
+        {
+            return count == 0;
+        }
+        std::size_t getMemSize() const;
+
+    private:
+        struct Slot
+        {
+            const IndexedEntry* entry = nullptr;
+            int index = 0;
+            std::uint32_t hash = 0;
+        };
+
+        static std::uint32_t hashName(const MappedName& name);
+        std::size_t findSlot(const MappedName& name,
+                             std::uint32_t hash,
+                             const MappedNameRef** ref) const;
+        void rehash(std::size_t minCount);
+
+        std::vector<Slot> slots;
+        std::size_t count = 0;
+        std::size_t deleted = 0;
+    };
+
+    MappedNameIndex mappedNames;
 
     struct ChildMapInfo
     {
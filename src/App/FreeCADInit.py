@@ -956,6 +956,27 @@ class ReturnType(IntEnum):
 
 App.ReturnType = ReturnType
 
+class NotificationBatch(object):
+    '''Context manager to batch the change notification of document objects
+
+    Document observers implementing slotBatchedChangedObject() are notified
+    once per object and property on exit, while slotChangedObject() is still
+    called immediately, e.g.
+
+        with FreeCAD.NotificationBatch():
+            for obj in objects:
+                obj.Placement = placement
+    '''
+    def __enter__(self):
+        App.beginNotificationBatch()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        App.endNotificationBatch()
+        return False
+
+App.NotificationBatch = NotificationBatch
+
 # clean up namespace
 del(InitApplications)
 
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#endif
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "NotificationBatch.h"
+#include "Application.h"
+#include "Document.h"
+#include "DocumentObject.h"
+
+
+FC_LOG_LEVEL_INIT("App", true, true)
+
+using namespace App;
+
+namespace
+{
+
+// Objects and dynamic properties may be removed while the batch is active, so
+// they are looked up again by name on delivery
+struct Change
+{
+    std::string document;
+    long id;
+    std::string property;
+
+    bool operator<(const Change& other) const
+    {
+        return std::tie(document, id, property)
+            < std::tie(other.document, other.id, other.property);
+    }
+};
+
+int batchCount;
+std::vector<Change> pendingChanges;
+std::set<Change> pendingKeys;
+
+}  // namespace
+
+NotificationBatch::NotificationBatch()
+{
+    begin();
+}
+
+NotificationBatch::~NotificationBatch()
+{
+    end();
+}
+
+void NotificationBatch::begin()
+{
+    ++batchCount;
+}
+
+bool NotificationBatch::end()
+{
+    if (batchCount <= 0) {
+        return false;
+    }
+    if (--batchCount == 0) {
+        flush();
+    }
+    return true;
+}
+
+bool NotificationBatch::isActive()
+{
+    return batchCount > 0;
+}
+
+void NotificationBatch::notifyChange(const DocumentObject& obj, const Property& prop)
+{
+    const Document* doc = obj.getDocument();
+    if (batchCount <= 0 || !doc || !prop.getName()) {
+        GetApplication().signalBatchedChangedObject(obj, prop);
+        return;
+    }
+    Change change {doc->getName(), obj.getID(), prop.getName()};
+    if (pendingKeys.insert(change).second) {
+        pendingChanges.push_back(std::move(change));
+    }
+}
+
+void NotificationBatch::flush()
+{
+    if (pendingChanges.empty()) {
+        return;
+    }
+    // Changes made by the observers are signaled immediately
+    std::vector<Change> changes;
+    changes.swap(pendingChanges);
+    pendingKeys.clear();
+
+    auto& app = GetApplication();
+    try {
+        app.signalBeforeBatchedChanges();
+        for (const auto& change : changes) {
+            Document* doc = app.getDocument(change.document.c_str());
+            if (!doc) {
+                continue;
+            }
+            DocumentObject* obj = doc->getObjectByID(change.id);
+            if (!obj || !obj->isAttachedToDocument()) {
+                continue;
+            }
+            Property* prop = obj->getPropertyByName(change.property.c_str());
+            if (prop) {
+                app.signalBatchedChangedObject(*obj, *prop);
+            }
+        }
+        app.signalAfterBatchedChanges();
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+    }
+    catch (std::exception& e) {
+        FC_ERR("Exception on delivering batched changes: " << e.what());
+    }
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef APP_NOTIFICATIONBATCH_H
+#define APP_NOTIFICATIONBATCH_H
+
+#include <cstddef>
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+class Property;
+
+/** Helper class to batch the change notification of document objects
+ *
+ * Application::signalBatchedChangedObject is emitted for every property
+ * change of a document object, like Application::signalChangedObject. While
+ * any instance of this class exists, the emission is deferred instead, and
+ * the changes are coalesced per object and property. They are signaled once
+ * when the last instance is destroyed, in the order of their first change.
+ * Changes of objects or dynamic properties that were removed in the meantime
+ * are dropped.
+ *
+ * Only observers that opted in by connecting to signalBatchedChangedObject,
+ * like the tree view and the property view, are affected. Document::signalChangedObject and
+ * Application::signalChangedObject are still emitted immediately, because
+ * e.g. shape caches and links rely on them to stay consistent.
+ *
+ * Application::signalBeforeBatchedChanges and
+ * Application::signalAfterBatchedChanges enclose the delivery of the batched
+ * changes, e.g. to refresh a view only once.
+ */
+class AppExport NotificationBatch
+{
+public:
+    /// Private new operator to prevent heap allocation
+    void* operator new(std::size_t) = delete;
+
+    NotificationBatch();
+    ~NotificationBatch();
+
+    NotificationBatch(const NotificationBatch&) = delete;
+    NotificationBatch& operator=(const NotificationBatch&) = delete;
+
+    /// Start a batch without a scope, used by the Python interface
+    static void begin();
+    /** End a batch started by begin()
+     * @return false if there is no active batch
+     */
+    static bool end();
+
+    /// Check if changes are currently batched
+    static bool isActive();
+
+    /** Signal the change of a property by Application::signalBatchedChangedObject
+     * or queue it if a batch is active
+     */
+    static void notifyChange(const DocumentObject& obj, const Property& prop);
+
+private:
+    static void flush();
+};
+
+}  // namespace App
+
+#endif  // APP_NOTIFICATIONBATCH_H
@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 
 #include "Property.h"
+#include "DocumentObject.h"
 #include "ObjectIdentifier.h"
 #include "PropertyContainer.h"
 
@@ -227,6 +228,8 @@ void Property::hasSetValue()
 {
     PropertyCleaner guard(this);
     if (father) {
+        if (father->isDerivedFrom(DocumentObject::getClassTypeId()))
+            static_cast<DocumentObject*>(father)->invalidateSubObjectCache(this);
         father->onChanged(this);
         if(!testStatus(Busy)) {
             Base::BitsetLocker<decltype(StatusBits)> guard(StatusBits,Busy);
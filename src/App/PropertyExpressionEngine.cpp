@@ -31,6 +31,7 @@
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "CompiledExpression.h"
 #include "ExpressionVisitors.h"
 
 
@@ -128,6 +129,8 @@ Property *PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    invalidateCache();
+
     App::DocumentObject *owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if(!owner || !owner->isAttachedToDocument() || owner->isRestoring() || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -201,6 +204,15 @@ void PropertyExpressionEngine::hasSetValue()
     PropertyExpressionContainer::hasSetValue();
 }
 
+void PropertyExpressionEngine::invalidateCache()
+{
+    evaluationOrderValid = false;
+    for (auto &e : expressions) {
+        e.second.compiled.reset();
+        e.second.compiledChecked = false;
+    }
+}
+
 void PropertyExpressionEngine::updateHiddenReference(const std::string &key) {
     if(!pimpl)
         return;
@@ -519,6 +531,25 @@ struct cycle_detector : public boost::dfs_visitor<> {
     int & _src;
 };
 
+/**
+ * @brief Check whether the binding of \a prop is evaluated with \a option.
+ */
+
+bool PropertyExpressionEngine::isExecutable(const Property *prop, ExecuteOption option)
+{
+    if(option == ExecuteAll)
+        return true;
+    bool is_output = prop->testStatus(App::Property::Output)||(prop->getType()&App::Prop_Output);
+    if((is_output && option==ExecuteNonOutput) || (!is_output && option==ExecuteOutput))
+        return false;
+    if(option == ExecuteOnRestore
+            && !prop->testStatus(Property::Transient)
+            && !(prop->getType() & Prop_Transient)
+            && !prop->testStatus(Property::EvalOnRestore))
+        return false;
+    return true;
+}
+
 /**
  * @brief Build a graph of all expressions in \a exprs.
  * @param exprs Expressions to use in graph
@@ -539,13 +570,7 @@ void PropertyExpressionEngine::buildGraph(const ExpressionMap & exprs,
             auto prop = expr.first.getProperty();
             if(!prop)
                 throw Base::RuntimeError("Path does not resolve to a property.");
-            bool is_output = prop->testStatus(App::Property::Output)||(prop->getType()&App::Prop_Output);
-            if((is_output && option==ExecuteNonOutput) || (!is_output && option==ExecuteOutput))
-                continue;
-            if(option == ExecuteOnRestore
-                    && !prop->testStatus(Property::Transient)
-                    && !(prop->getType() & Prop_Transient)
-                    && !prop->testStatus(Property::EvalOnRestore))
+            if(!isExecutable(prop, option))
                 continue;
         }
         buildGraphStructures(expr.first, expr.second.expression, nodes, revNodes, edges);
@@ -647,8 +672,12 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
-    // Compute evaluation order
-    std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
+    // The evaluation order of all expressions is cached until the expressions change. Skipping
+    // the bindings excluded by the option keeps the order of the remaining ones valid.
+    if (!evaluationOrderValid) {
+        evaluationOrder = computeEvaluationOrder(ExecuteAll);
+        evaluationOrderValid = true;
+    }
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
 
 #ifdef FC_PROPERTYEXPRESSIONENGINE_LOG
@@ -664,6 +693,9 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
         if (!prop)
             throw Base::RuntimeError("Path does not resolve to a property.");
 
+        if (!isExecutable(prop, option))
+            continue;
+
         DocumentObject* parent = freecad_dynamic_cast<DocumentObject>(prop->getContainer());
 
         /* Make sure property belongs to the same container as this PropertyExpressionEngine */
@@ -673,10 +705,17 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
         /* Set value of property */
         App::any value;
         try {
-            // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
+            // Evaluate expression, numeric expressions are compiled on first use
+            ExpressionInfo &info = expressions[*it];
+            if (info.expression && !info.compiledChecked) {
+                info.compiled = CompiledExpression::compile(info.expression.get());
+                info.compiledChecked = true;
+            }
+            std::shared_ptr<App::Expression> expression = info.expression;
+            std::shared_ptr<const App::CompiledExpression> compiled = info.compiled;
             if (expression) {
-                value = expression->getValueAsAny();
+                if (!compiled || !compiled->eval(value))
+                    value = expression->getValueAsAny();
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -1073,6 +1112,7 @@ void PropertyExpressionEngine::setExpressions(
 
 void PropertyExpressionEngine::onRelabeledDocument(const App::Document &doc)
 {
+    invalidateCache();
     RelabelDocumentExpressionVisitor v(doc);
     for(auto &e : expressions) {
         if (e.second.expression)
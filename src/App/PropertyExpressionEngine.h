@@ -42,6 +42,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class CompiledExpression;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer : public App::PropertyXLinkContainer
@@ -85,6 +86,8 @@ public:
 
     struct ExpressionInfo {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        std::shared_ptr<const App::CompiledExpression> compiled; /**< Fast path for numeric expressions */
+        bool compiledChecked = false;
         bool busy;
 
         explicit ExpressionInfo(std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>()) {
@@ -180,6 +183,10 @@ private:
 
     std::vector<App::ObjectIdentifier> computeEvaluationOrder(ExecuteOption option);
 
+    static bool isExecutable(const Property *prop, ExecuteOption option);
+
+    void invalidateCache();
+
     void buildGraphStructures(const App::ObjectIdentifier &path,
                               const std::shared_ptr<Expression> expression, boost::unordered_map<App::ObjectIdentifier, int> &nodes,
                               boost::unordered_map<int, App::ObjectIdentifier> &revNodes, std::vector<Edge> &edges) const;
@@ -195,6 +202,10 @@ private:
     bool running = false; /**< Boolean used to avoid loops */
     bool restoring = false;
 
+    /**< Evaluation order of all expressions, computed on first execute after a change */
+    std::vector<App::ObjectIdentifier> evaluationOrder;
+    bool evaluationOrderValid = false;
+
     ExpressionMap expressions; /**< Stored expressions */
 
     ValidatorFunc validator; /**< Valdiator functor */
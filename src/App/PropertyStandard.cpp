@@ -1330,18 +1330,8 @@ void PropertyString::setValue(const char* newLabel)
         }
         App::Document* doc = obj->getDocument();
         if(doc && !_hPGrp->GetBool("DuplicateLabels") && !obj->allowDuplicateLabel()) {
-            std::vector<std::string> objectLabels;
-            std::vector<App::DocumentObject*>::const_iterator it;
-            std::vector<App::DocumentObject*> objs = doc->getObjects();
-            bool match = false;
-            for (it = objs.begin();it != objs.end();++it) {
-                if (*it == obj)
-                    continue; // don't compare object with itself
-                std::string objLabel = (*it)->Label.getValue();
-                if (!match && objLabel == newLabel)
-                    match = true;
-                objectLabels.push_back(objLabel);
-            }
+            // don't compare object with itself
+            bool match = doc->containsObjectLabel(newLabel, obj);
 
             // make sure that there is a name conflict otherwise we don't have to do anything
             if (match && *newLabel) {
@@ -1371,15 +1361,14 @@ void PropertyString::setValue(const char* newLabel)
                         if(*c<48 || *c>57)
                             break;
                     }
-                    if(*c == 0 && std::find(objectLabels.begin(), objectLabels.end(),
-                                            obj->getNameInDocument())==objectLabels.end())
+                    if(*c == 0 && !doc->containsObjectLabel(obj->getNameInDocument(), obj))
                     {
                         label = obj->getNameInDocument();
                         changed = true;
                     }
                 }
                 if(!changed)
-                    label = Base::Tools::getUniqueName(label, objectLabels, 3);
+                    label = doc->getUniqueObjectLabel(label, obj, 3);
             }
         }
 
@@ -30,9 +30,12 @@
 #include <App/DocumentObject.h>
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
+#include <Base/Matrix.h>
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -57,6 +60,79 @@ namespace App {
 using HasherMap = boost::bimap<StringHasherRef, int>;
 class Transaction;
 
+/** Keeps track of the numeric suffixes of a set of names, grouped by the base name without
+ * the suffix. This gives the same unique names as Base::Tools::getUniqueName() without
+ * iterating over all names. A name may be added more than once, e.g. duplicate labels.
+ */
+class UniqueNameIndex
+{
+public:
+    void add(const std::string& name);
+    void remove(const std::string& name);
+    void clear();
+    bool contains(const std::string& name) const;
+    int count(const std::string& name) const;
+    /// Same as Base::Tools::getUniqueName(), one occurrence of \a exclude is ignored
+    std::string getUniqueName(const std::string& name,
+                              int pad,
+                              const std::string* exclude = nullptr) const;
+
+private:
+    struct SuffixLess
+    {
+        bool operator()(const std::string& s1, const std::string& s2) const
+        {
+            return s1.size() != s2.size() ? s1.size() < s2.size() : s1 < s2;
+        }
+    };
+    using SuffixMap = std::map<std::string, int, SuffixLess>;
+
+    static bool splitName(const std::string& name, std::string& base, std::string& suffix);
+
+    std::unordered_map<std::string, int> names;
+    std::unordered_map<std::string, SuffixMap> suffixes;
+};
+
+/** Results of DocumentObject::getSubObjectCached() for the objects of a document.
+ * The entries are dropped as soon as the global generation counter no longer
+ * matches \a generation.
+ */
+struct SubObjectCache
+{
+    struct Key
+    {
+        long id;
+        bool transform;
+        std::string subname;
+
+        bool operator==(const Key& other) const
+        {
+            return id == other.id && transform == other.transform && subname == other.subname;
+        }
+    };
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = std::hash<std::string>()(key.subname);
+            seed ^= std::hash<long>()(key.id) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return key.transform ? ~seed : seed;
+        }
+    };
+    struct Entry
+    {
+        DocumentObject* obj;
+        // transformation relative to the input matrix of getSubObject()
+        Base::Matrix4D mat;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    unsigned long generation = 0;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+};
+
 // Pimpl class
 struct DocumentP
 {
@@ -64,6 +140,11 @@ struct DocumentP
     std::vector<DocumentObject*> objectArray;
     std::unordered_set<App::DocumentObject*> touchedObjs;
     std::unordered_map<std::string, DocumentObject*> objectMap;
+    // suffix indices of the object names and labels for getUniqueObjectName() and
+    // unique labels, the labels are stored per object to update the index on a change
+    UniqueNameIndex objectNames;
+    UniqueNameIndex objectLabels;
+    std::unordered_map<const DocumentObject*, std::string> indexedLabels;
     std::unordered_map<long, DocumentObject*> objectIdMap;
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
@@ -93,6 +174,8 @@ struct DocumentP
 
     StringHasherRef Hasher;
 
+    SubObjectCache subObjectCache;
+
     DocumentP();
 
     void addRecomputeLog(const char *why, App::DocumentObject *obj) {
@@ -128,6 +211,35 @@ struct DocumentP
         }
         objectMap.clear();
         objectIdMap.clear();
+        clearNameIndex();
+    }
+
+    void clearNameIndex() {
+        objectNames.clear();
+        objectLabels.clear();
+        indexedLabels.clear();
+    }
+
+    void indexLabel(const DocumentObject *obj, const std::string &label) {
+        auto it = indexedLabels.find(obj);
+        if (it != indexedLabels.end()) {
+            if (it->second == label)
+                return;
+            objectLabels.remove(it->second);
+            it->second = label;
+        }
+        else {
+            indexedLabels.emplace(obj, label);
+        }
+        objectLabels.add(label);
+    }
+
+    void unindexLabel(const DocumentObject *obj) {
+        auto it = indexedLabels.find(obj);
+        if (it != indexedLabels.end()) {
+            objectLabels.remove(it->second);
+            indexedLabels.erase(it);
+        }
     }
 
     const char *findRecomputeLog(const App::DocumentObject *obj) {
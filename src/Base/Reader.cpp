@@ -28,7 +28,11 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
+#include <condition_variable>
+#include <deque>
 #include <locale>
+#include <mutex>
+#include <thread>
 
 #include "Reader.h"
 #include "Base64.h"
@@ -52,6 +56,251 @@ XERCES_CPP_NAMESPACE_USE
 using namespace std;
 
 
+// ---------------------------------------------------------------------------
+//  Base::XMLReader::ParserThread
+// ---------------------------------------------------------------------------
+
+/* Calls parseNext() of the Xerces parser on a background thread and records
+ * the state changes of each call in the same way as the SAX handlers of
+ * XMLReader do. The tokens are passed in blocks to the reading thread, which
+ * applies them to the XMLReader in read().
+ */
+class Base::XMLReader::ParserThread: public DefaultHandler
+{
+public:
+    explicit ParserThread(XMLReader& reader)
+        : reader(reader)
+        , level(reader.Level)
+    {
+        reader.parser->setContentHandler(this);
+        reader.parser->setLexicalHandler(this);
+        thread = std::thread(&ParserThread::run, this);
+    }
+
+    ~ParserThread() override
+    {
+        stop();
+    }
+
+    ParserThread(const ParserThread&) = delete;
+    ParserThread& operator=(const ParserThread&) = delete;
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        spaceAvailable.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+            reader.parser->setContentHandler(&reader);
+            reader.parser->setLexicalHandler(&reader);
+        }
+    }
+
+    // Applies the next token to the reader, returns false if there is none left
+    bool next()
+    {
+        if (position >= block.size()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            tokenAvailable.wait(lock, [this]() {
+                return !blocks.empty() || finished;
+            });
+            if (blocks.empty()) {
+                return false;
+            }
+            block = std::move(blocks.front());
+            blocks.pop_front();
+            position = 0;
+            lock.unlock();
+            spaceAvailable.notify_one();
+        }
+
+        Token& token = block[position++];
+        reader.ReadType = token.type;
+        reader.Level = token.level;
+        if (token.error == Token::BaseError) {
+            throw Base::XMLBaseException(token.name);
+        }
+        if (token.error == Token::ParseError) {
+            throw Base::XMLParseException(token.name);
+        }
+        if (token.changes & Token::NameChanged) {
+            reader.LocalName = std::move(token.name);
+        }
+        if (token.changes & Token::AttributesChanged) {
+            reader.AttrMap = std::move(token.attributes);
+        }
+        if (token.changes & Token::CharactersChanged) {
+            reader.Characters = std::move(token.characters);
+        }
+        reader.CharacterCount += token.length;
+        return true;
+    }
+
+private:
+    struct Token
+    {
+        enum Changes
+        {
+            NameChanged = 1,
+            AttributesChanged = 2,
+            CharactersChanged = 4
+        };
+        enum Error
+        {
+            NoError,
+            BaseError,
+            ParseError
+        };
+        decltype(XMLReader::ReadType) type {XMLReader::None};
+        int level {0};
+        int changes {0};
+        Error error {NoError};
+        unsigned int length {0};
+        std::string name;
+        std::string characters;
+        AttrMapType attributes;
+    };
+
+    // number of tokens passed at once and the maximum number of queued blocks
+    static constexpr std::size_t blockSize {512};
+    static constexpr std::size_t maxBlocks {256};
+
+    void run()
+    {
+        std::vector<Token> pending;
+        pending.reserve(blockSize);
+        for (;;) {
+            pending.emplace_back();
+            current = &pending.back();
+            bool more {};
+            try {
+                more = reader.parser->parseNext(reader.token);
+            }
+            catch (const XMLException& toCatch) {
+                char* message = XMLString::transcode(toCatch.getMessage());
+                current->name = message;
+                XMLString::release(&message);
+                current->error = Token::BaseError;
+            }
+            catch (const SAXParseException& toCatch) {
+                char* message = XMLString::transcode(toCatch.getMessage());
+                current->name = message;
+                XMLString::release(&message);
+                current->error = Token::ParseError;
+            }
+            catch (...) {
+                current->name = "Unexpected XML exception";
+                current->error = Token::BaseError;
+            }
+            current->level = level;
+
+            bool last = !more || current->error != Token::NoError
+                || current->type == XMLReader::EndDocument;
+            if (last || pending.size() >= blockSize) {
+                std::unique_lock<std::mutex> lock(mutex);
+                spaceAvailable.wait(lock, [this]() {
+                    return blocks.size() < maxBlocks || stopping;
+                });
+                blocks.push_back(std::move(pending));
+                last = last || stopping;
+                lock.unlock();
+                tokenAvailable.notify_one();
+                pending.clear();
+                pending.reserve(blockSize);
+            }
+            if (last) {
+                break;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished = true;
+        }
+        tokenAvailable.notify_all();
+    }
+
+    // The handlers below must be kept in sync with the ones of XMLReader
+    void startDocument() override
+    {
+        current->type = XMLReader::StartDocument;
+    }
+
+    void endDocument() override
+    {
+        current->type = XMLReader::EndDocument;
+    }
+
+    void startElement(const XMLCh* const /*uri*/,
+                      const XMLCh* const localname,
+                      const XMLCh* const /*qname*/,
+                      const Attributes& attrs) override
+    {
+        level++;
+        current->name = StrX(localname).c_str();
+        current->attributes.clear();
+        for (unsigned int i = 0; i < attrs.getLength(); i++) {
+            current->attributes[StrX(attrs.getQName(i)).c_str()] =
+                StrXUTF8(attrs.getValue(i)).c_str();
+        }
+        current->changes |= Token::NameChanged | Token::AttributesChanged;
+        current->type = XMLReader::StartElement;
+    }
+
+    void endElement(const XMLCh* const /*uri*/,
+                    const XMLCh* const localname,
+                    const XMLCh* const /*qname*/) override
+    {
+        level--;
+        current->name = StrX(localname).c_str();
+        current->changes |= Token::NameChanged;
+        if (current->type == XMLReader::StartElement) {
+            current->type = XMLReader::StartEndElement;
+        }
+        else {
+            current->type = XMLReader::EndElement;
+        }
+    }
+
+    void startCDATA() override
+    {
+        current->type = XMLReader::StartCDATA;
+    }
+
+    void endCDATA() override
+    {
+        current->type = XMLReader::EndCDATA;
+    }
+
+    void characters(const XMLCh* const chars, const XMLSize_t length) override
+    {
+        current->characters = StrX(chars).c_str();
+        current->changes |= Token::CharactersChanged;
+        current->type = XMLReader::Chars;
+        current->length += static_cast<unsigned int>(length);
+    }
+
+    XMLReader& reader;
+    int level;
+    Token* current {nullptr};
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable tokenAvailable;
+    std::condition_variable spaceAvailable;
+    std::deque<std::vector<Token>> blocks;
+    bool stopping {false};
+    bool finished {false};
+
+    // the block of tokens currently read, only used by the reading thread
+    std::vector<Token> block;
+    std::size_t position {0};
+};
+
+
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Constructors and Destructor
 // ---------------------------------------------------------------------------
@@ -95,6 +344,8 @@ Base::XMLReader::XMLReader(const char* FileName, std::istream& str)
 
 Base::XMLReader::~XMLReader()
 {
+    // the parser thread must have finished before the parser is deleted
+    parserThread.reset();
     //  Delete the parser itself.  Must be done prior to calling Terminate, below.
     delete parser;
 }
@@ -168,6 +419,14 @@ bool Base::XMLReader::hasAttribute(const char* AttrName) const
 
 bool Base::XMLReader::read()
 {
+    if (parserThread) {
+        if (parserThread->next()) {
+            return true;
+        }
+        // all tokens of the parser thread are read, continue on this thread
+        parserThread.reset();
+    }
+
     ReadType = None;
 
     try {
@@ -654,6 +913,20 @@ void Base::XMLReader::clearPartialRestoreObject()
     setStatus(PartialRestoreInObject, false);
 }
 
+void Base::XMLReader::startConcurrentParsing()
+{
+    if (!parserThread && _valid) {
+        parserThread = std::make_unique<ParserThread>(*this);
+    }
+}
+
+void Base::XMLReader::stopConcurrentParsing()
+{
+    if (parserThread) {
+        parserThread->stop();
+    }
+}
+
 // ----------------------------------------------------------
 
 // NOLINTNEXTLINE
@@ -259,6 +259,22 @@ public:
     /// set the status bits
     void setStatus(ReaderStatus pos, bool on);
 
+    /** @name Concurrent parsing */
+    //@{
+    /** Continue parsing the document on a background thread
+     * The remaining XML is tokenized into a queue ahead of the reading
+     * methods, which then only take the next token. The input stream must not
+     * be used otherwise until stopConcurrentParsing() has been called, e.g.
+     * before calling readFiles().
+     */
+    void startConcurrentParsing();
+    /** Stop the background parsing and wait for the parser thread
+     * The tokens that are already parsed are still returned by the reading
+     * methods, after that the parsing continues on the calling thread.
+     */
+    void stopConcurrentParsing();
+    //@}
+
 protected:
     /// read the next element
     bool read();
@@ -348,6 +364,9 @@ private:
     std::bitset<32> StatusBits;
 
     std::unique_ptr<std::istream> CharStream;
+
+    class ParserThread;
+    std::unique_ptr<ParserThread> parserThread;
 };
 
 class BaseExport Reader: public std::istream
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <numeric>
+#endif
+
+#include "TriangleBVH.h"
+
+using namespace Gui::Inventor;
+
+namespace {
+
+// Maximum number of triangles stored in a leaf
+constexpr uint32_t maxLeafSize = 8;
+
+struct BuildData
+{
+    std::vector<SbBox3f> boxes;
+    std::vector<SbVec3f> centers;
+};
+
+}
+
+void TriangleBVH::clear()
+{
+    nodes.clear();
+    nodes.shrink_to_fit();
+    triangles.clear();
+    triangles.shrink_to_fit();
+}
+
+SbBox3f TriangleBVH::getBoundingBox() const
+{
+    if (nodes.empty()) {
+        return {};
+    }
+    return nodes.front().box;
+}
+
+void TriangleBVH::build(std::size_t numTriangles, const TriangleFunc& getTriangle)
+{
+    clear();
+    if (numTriangles == 0) {
+        return;
+    }
+
+    BuildData data;
+    data.boxes.resize(numTriangles);
+    data.centers.resize(numTriangles);
+    SbVec3f v1, v2, v3;
+    for (std::size_t i = 0; i < numTriangles; i++) {
+        getTriangle(i, v1, v2, v3);
+        SbBox3f& box = data.boxes[i];
+        box.makeEmpty();
+        box.extendBy(v1);
+        box.extendBy(v2);
+        box.extendBy(v3);
+        data.centers[i] = box.getCenter();
+    }
+
+    triangles.resize(numTriangles);
+    std::iota(triangles.begin(), triangles.end(), 0);
+    // a binary tree with at most maxLeafSize triangles per leaf
+    nodes.reserve(2 * (numTriangles / maxLeafSize + 1));
+
+    // The nodes are stored in depth-first order so that the left child of an inner
+    // node always directly follows its parent. The right child index is patched in
+    // once the left sub-tree is complete.
+    struct Range
+    {
+        uint32_t first;
+        uint32_t count;
+        uint32_t parent;
+        bool right;
+    };
+
+    std::vector<Range> todo;
+    todo.push_back({0, static_cast<uint32_t>(numTriangles), 0, false});
+    while (!todo.empty()) {
+        Range range = todo.back();
+        todo.pop_back();
+
+        auto index = static_cast<uint32_t>(nodes.size());
+        if (range.right) {
+            nodes[range.parent].first = index;
+        }
+
+        nodes.emplace_back();
+        Node& node = nodes.back();
+        SbBox3f centerBox;
+        for (uint32_t i = range.first; i < range.first + range.count; i++) {
+            node.box.extendBy(data.boxes[triangles[i]]);
+            centerBox.extendBy(data.centers[triangles[i]]);
+        }
+
+        float dx {}, dy {}, dz {};
+        centerBox.getSize(dx, dy, dz);
+        if (range.count <= maxLeafSize || std::max({dx, dy, dz}) <= 0.0F) {
+            node.first = range.first;
+            node.count = range.count;
+            continue;
+        }
+
+        // split at the median of the longest axis of the triangle centers
+        int axis = 0;
+        if (dy > dx && dy >= dz) {
+            axis = 1;
+        }
+        else if (dz > dx && dz > dy) {
+            axis = 2;
+        }
+
+        auto begin = triangles.begin() + range.first;
+        auto end = begin + range.count;
+        auto middle = begin + range.count / 2;
+        std::nth_element(begin, middle, end, [&data, axis](uint32_t a, uint32_t b) {
+            return data.centers[a][axis] < data.centers[b][axis];
+        });
+
+        uint32_t half = range.count / 2;
+        // the left child is pushed last and therefore handled first
+        todo.push_back({range.first + half, range.count - half, index, true});
+        todo.push_back({range.first, half, index, false});
+    }
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef GUI_INVENTOR_TRIANGLEBVH_H
+#define GUI_INVENTOR_TRIANGLEBVH_H
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbVec3f.h>
+#include <FCGlobal.h>
+
+
+namespace Gui { namespace Inventor {
+
+/**
+ * The TriangleBVH class is a bounding volume hierarchy over a set of triangles.
+ *
+ * It is used by shape nodes with a huge number of triangles to avoid generating
+ * all primitives on every ray pick or box/lasso selection. The hierarchy only
+ * stores the triangle indices and the bounding boxes of its nodes, the caller
+ * is responsible to access the actual vertices when a leaf is visited.
+ *
+ * The hierarchy must be rebuilt whenever the coordinates or the topology of the
+ * owning shape change.
+ */
+class GuiExport TriangleBVH
+{
+public:
+    /// Result of testing a node's bounding box against a query volume
+    enum class Overlap
+    {
+        Outside,
+        Partial,
+        Inside
+    };
+
+    /// Callback to get the three vertices of the triangle with the given index
+    using TriangleFunc = std::function<void(std::size_t, SbVec3f&, SbVec3f&, SbVec3f&)>;
+
+    TriangleBVH() = default;
+
+    /// Builds the hierarchy for \a numTriangles triangles
+    void build(std::size_t numTriangles, const TriangleFunc& getTriangle);
+    /// Removes all nodes
+    void clear();
+    bool isEmpty() const
+    {
+        return nodes.empty();
+    }
+    std::size_t countTriangles() const
+    {
+        return triangles.size();
+    }
+    /// Returns the bounding box of all triangles
+    SbBox3f getBoundingBox() const;
+
+    /**
+     * Traverses the hierarchy. \a testBox is called with the bounding box of each visited
+     * node and must return an Overlap value. Sub-trees that are outside are skipped, and
+     * for each triangle of a partially overlapping leaf or of a sub-tree that lies completely
+     * inside \a visit is called with the triangle index and a flag whether the triangle is
+     * known to be inside the query volume.
+     */
+    template<typename BoxTest, typename Visitor>
+    void traverse(BoxTest&& testBox, Visitor&& visit) const
+    {
+        if (nodes.empty()) {
+            return;
+        }
+
+        std::vector<std::pair<uint32_t, bool>> stack;
+        stack.emplace_back(0, false);
+        while (!stack.empty()) {
+            auto [index, inside] = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[index];
+            if (!inside) {
+                Overlap overlap = testBox(node.box);
+                if (overlap == Overlap::Outside) {
+                    continue;
+                }
+                inside = (overlap == Overlap::Inside);
+            }
+
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    visit(static_cast<std::size_t>(triangles[i]), inside);
+                }
+            }
+            else {
+                stack.emplace_back(node.first, inside);
+                stack.emplace_back(index + 1, inside);
+            }
+        }
+    }
+
+private:
+    // Leaf nodes have count > 0 and first is the offset into the triangle list.
+    // Inner nodes have count == 0, the left child directly follows the node and
+    // first is the index of the right child.
+    struct Node
+    {
+        SbBox3f box;
+        uint32_t first {0};
+        uint32_t count {0};
+    };
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> triangles;
+};
+
+} // namespace Inventor
+
+} // namespace Gui
+
+#endif // GUI_INVENTOR_TRIANGLEBVH_H
@@ -104,9 +104,17 @@ PropertyView::PropertyView(QWidget *parent)
     connect(tabs, &QTabWidget::currentChanged, this, &PropertyView::tabChanged);
 
     //NOLINTBEGIN
+    // Changes are coalesced by App::NotificationBatch and the editor is
+    // refreshed only once after the batch
     this->connectPropData =
-    App::GetApplication().signalChangedObject.connect(std::bind
+    App::GetApplication().signalBatchedChangedObject.connect(std::bind
         (&PropertyView::slotChangePropertyData, this, sp::_2));
+    this->connectBeforeBatch =
+    App::GetApplication().signalBeforeBatchedChanges.connect(std::bind
+        (&PropertyView::slotBeforeBatchedChanges, this));
+    this->connectAfterBatch =
+    App::GetApplication().signalAfterBatchedChanges.connect(std::bind
+        (&PropertyView::slotAfterBatchedChanges, this));
     this->connectPropView =
     Gui::Application::Instance->signalChangedObject.connect(std::bind
         (&PropertyView::slotChangePropertyView, this, sp::_1, sp::_2));
@@ -156,6 +164,8 @@ PropertyView::~PropertyView()
     this->connectDelObject.disconnect();
     this->connectDelViewObject.disconnect();
     this->connectChangedDocument.disconnect();
+    this->connectBeforeBatch.disconnect();
+    this->connectAfterBatch.disconnect();
 }
 
 static bool _ShowAll;
@@ -216,10 +226,26 @@ void PropertyView::slotChangePropertyData(const App::Property& prop)
 {
     if (propertyEditorData->propOwners.count(prop.getContainer())) {
         propertyEditorData->updateProperty(prop);
-        timer->start(ViewParams::instance()->getPropertyViewTimer());
+        if (deliveringBatch)
+            batchChanged = true;
+        else
+            timer->start(ViewParams::instance()->getPropertyViewTimer());
     }
 }
 
+void PropertyView::slotBeforeBatchedChanges()
+{
+    deliveringBatch = true;
+    batchChanged = false;
+}
+
+void PropertyView::slotAfterBatchedChanges()
+{
+    deliveringBatch = false;
+    if (batchChanged)
+        timer->start(ViewParams::instance()->getPropertyViewTimer());
+}
+
 void PropertyView::slotChangePropertyView(const Gui::ViewProvider&, const App::Property& prop)
 {
     if (propertyEditorView->propOwners.count(prop.getContainer())) {
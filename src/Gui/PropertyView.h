@@ -79,6 +79,8 @@ protected:
 private:
     void onSelectionChanged(const SelectionChanges& msg) override;
     void slotChangePropertyData(const App::Property&);
+    void slotBeforeBatchedChanges();
+    void slotAfterBatchedChanges();
     void slotChangePropertyView(const Gui::ViewProvider&, const App::Property&);
     void slotAppendDynamicProperty(const App::Property&);
     void slotRemoveDynamicProperty(const App::Property&);
@@ -107,9 +109,13 @@ private:
     Connection connectDelObject;
     Connection connectDelViewObject;
     Connection connectChangedDocument;
+    Connection connectBeforeBatch;
+    Connection connectAfterBatch;
     QTabWidget* tabs;
     QTimer* timer;
     bool updating = false;
+    bool deliveringBatch = false;
+    bool batchChanged = false;
 };
 
 namespace DockWnd {
@@ -46,6 +46,7 @@
 #include <Base/Tools.h>
 #include <Base/Writer.h>
 
+#include <App/Application.h>
 #include <App/Color.h>
 #include <App/Document.h>
 #include <App/DocumentObjectGroup.h>
@@ -583,6 +584,13 @@ TreeWidget::TreeWidget(const char* name, QWidget* parent)
     // for
     connectChangedViewObj = Application::Instance->signalChangedObject.connect(
         std::bind(&TreeWidget::slotChangedViewObject, this, sp::_1, sp::_2));
+
+    // The object changes are received through App::Application::signalBatchedChangedObject
+    // (see DocumentItem), so that the status is updated only once after a batch of changes
+    connectBeforeBatch = App::GetApplication().signalBeforeBatchedChanges.connect(
+        std::bind(&TreeWidget::slotBeforeBatchedChanges, this));
+    connectAfterBatch = App::GetApplication().signalAfterBatchedChanges.connect(
+        std::bind(&TreeWidget::slotAfterBatchedChanges, this));
     //NOLINTEND
 
     setupResizableColumn(this);
@@ -641,6 +649,8 @@ TreeWidget::~TreeWidget()
     connectRelDocument.disconnect();
     connectShowHidden.disconnect();
     connectChangedViewObj.disconnect();
+    connectBeforeBatch.disconnect();
+    connectAfterBatch.disconnect();
     Instances.erase(this);
     if (_LastSelectedTreeWidget == this)
         _LastSelectedTreeWidget = nullptr;
@@ -2929,8 +2939,8 @@ void TreeWidget::onUpdateStatus()
 
         if (!docItem->connectChgObject.connected()) {
             //NOLINTBEGIN
-            docItem->connectChgObject = docItem->document()->signalChangedObject.connect(
-                std::bind(&TreeWidget::slotChangeObject, this, sp::_1, sp::_2));
+            docItem->connectChgObject = App::GetApplication().signalBatchedChangedObject.connect(
+                std::bind(&DocumentItem::slotChangeObject, docItem, sp::_1, sp::_2));
             docItem->connectTouchedObject = doc->signalTouchedObject.connect(
                 std::bind(&TreeWidget::slotTouchedObject, this, sp::_1));
             //NOLINTEND
@@ -3594,8 +3604,8 @@ DocumentItem::DocumentItem(const Gui::Document* doc, QTreeWidgetItem* parent)
     connectDelObject = doc->signalDeletedObject.connect(
         std::bind(&TreeWidget::slotDeleteObject, getTree(), sp::_1));
     if (!App::GetApplication().isRestoring()) {
-        connectChgObject = doc->signalChangedObject.connect(
-            std::bind(&TreeWidget::slotChangeObject, getTree(), sp::_1, sp::_2));
+        connectChgObject = App::GetApplication().signalBatchedChangedObject.connect(
+            std::bind(&DocumentItem::slotChangeObject, this, sp::_1, sp::_2));
         connectTouchedObject = doc->getDocument()->signalTouchedObject.connect(
             std::bind(&TreeWidget::slotTouchedObject, getTree(), sp::_1));
     }
@@ -4171,7 +4181,8 @@ void TreeWidget::slotChangeObject(
     if (itEntry == ObjectTable.end() || itEntry->second.empty())
         return;
 
-    _updateStatus();
+    if (!deliveringBatch)
+        _updateStatus();
 
     // Let's not waste time on the newly added Visibility property in
     // DocumentObject.
@@ -4214,6 +4225,17 @@ void TreeWidget::slotChangeObject(
     }
 }
 
+void TreeWidget::slotBeforeBatchedChanges()
+{
+    deliveringBatch = true;
+}
+
+void TreeWidget::slotAfterBatchedChanges()
+{
+    deliveringBatch = false;
+    _updateStatus();
+}
+
 void TreeWidget::updateChildren(App::DocumentObject* obj,
     const std::set<DocumentObjectDataPtr>& dataSet, bool propOutput, bool force)
 {
@@ -4487,6 +4509,15 @@ void DocumentItem::slotScrollToObject(const Gui::ViewProviderDocumentObject& obj
     getTree()->scrollToItem(item);
 }
 
+void DocumentItem::slotChangeObject(const App::DocumentObject& obj, const App::Property& prop)
+{
+    if (obj.getDocument() != pDocument->getDocument())
+        return;
+    auto vp = Base::freecad_dynamic_cast<ViewProviderDocumentObject>(pDocument->getViewProvider(&obj));
+    if (vp)
+        getTree()->slotChangeObject(*vp, prop);
+}
+
 void DocumentItem::slotRecomputedObject(const App::DocumentObject& obj) {
     if (obj.isValid())
         return;
@@ -209,6 +209,8 @@ private:
     void slotDeleteObject(const Gui::ViewProviderDocumentObject&);
     void slotChangeObject(const Gui::ViewProviderDocumentObject&, const App::Property &prop);
     void slotTouchedObject(const App::DocumentObject&);
+    void slotBeforeBatchedChanges();
+    void slotAfterBatchedChanges();
 
     void changeEvent(QEvent *e) override;
     void setupText();
@@ -261,6 +263,7 @@ private:
 
     std::string myName; // for debugging purpose
     int updateBlocked = 0;
+    bool deliveringBatch = false;
 
     friend class DocumentItem;
     friend class DocumentObjectItem;
@@ -275,6 +278,8 @@ private:
     Connection connectRelDocument;
     Connection connectShowHidden;
     Connection connectChangedViewObj;
+    Connection connectBeforeBatch;
+    Connection connectAfterBatch;
 };
 
 /** The link between the tree and a document.
@@ -342,6 +347,7 @@ protected:
     void slotExpandObject    (const Gui::ViewProviderDocumentObject&,const Gui::TreeItemMode&,
                               const App::DocumentObject *parent, const char *subname);
     void slotScrollToObject  (const Gui::ViewProviderDocumentObject&);
+    void slotChangeObject    (const App::DocumentObject&, const App::Property &prop);
     void slotRecomputed      (const App::Document &doc, const std::vector<App::DocumentObject*> &objs);
     void slotRecomputedObject(const App::DocumentObject &);
 
@@ -30,7 +30,10 @@
 #include <gp_Circ.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Sphere.hxx>
+#include <Precision.hxx>
+#include <array>
 #include <cmath>
+#include <set>
 #include <vector>
 #include <unordered_map>
 #endif
@@ -101,14 +104,48 @@ PyObject* AssemblyObject::getPyObject()
 }
 
 
-int AssemblyObject::solve(bool enableRedo)
+namespace
 {
-    mbdAssembly = makeMbdAssembly();
-    objectPartMap.clear();
+void setMbdPartPlacement(const std::shared_ptr<ASMTPart>& mbdPart, const Base::Placement& plc)
+{
+    Base::Vector3d pos = plc.getPosition();
+    mbdPart->setPosition3D(pos.x, pos.y, pos.z);
 
-    std::vector<App::DocumentObject*> groundedObjs = fixGroundedParts();
+    // TODO : replace with quaternion to simplify
+    Base::Rotation rot = plc.getRotation();
+    Base::Matrix4D mat;
+    rot.getValue(mat);
+    Base::Vector3d r0 = mat.getRow(0);
+    Base::Vector3d r1 = mat.getRow(1);
+    Base::Vector3d r2 = mat.getRow(2);
+    mbdPart->setRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+}
+
+// Properties of the joints from which the solver model is built. The placement of a
+// grounded joint is the one its part is fixed to.
+const std::array<const char*, 14> solverJointProperties = {"JointType",
+                                                           "Object1",
+                                                           "Object2",
+                                                           "Part1",
+                                                           "Part2",
+                                                           "Element1",
+                                                           "Element2",
+                                                           "Vertex1",
+                                                           "Vertex2",
+                                                           "Placement1",
+                                                           "Placement2",
+                                                           "Distance",
+                                                           "ObjectToGround",
+                                                           "Placement"};
+}  // namespace
+
+int AssemblyObject::solve(bool enableRedo)
+{
+    std::vector<App::DocumentObject*> groundedJoints = getGroundedJoints();
+    std::vector<App::DocumentObject*> groundedObjs = getGroundedParts();
     if (groundedObjs.empty()) {
         // If no part fixed we can't solve.
+        invalidateMbdAssembly();
         return -6;
     }
 
@@ -116,7 +153,22 @@ int AssemblyObject::solve(bool enableRedo)
 
     removeUnconnectedJoints(joints, groundedObjs);
 
-    jointParts(joints);
+    bool rebuild = !isMbdAssemblyUpToDate(groundedJoints, joints);
+    if (!rebuild) {
+        // Only the placements of the parts changed, e.g. while dragging
+        updateMbdPartPlacements();
+    }
+    else {
+        // Stays invalid if building the model throws
+        invalidateMbdAssembly();
+        mbdAssembly = makeMbdAssembly();
+        objectPartMap.clear();
+
+        fixGroundedParts();
+        jointParts(joints);
+
+        saveMbdAssemblyState(groundedJoints, joints);
+    }
 
     if (enableRedo) {
         savePlacementsForUndo();
@@ -127,64 +179,205 @@ int AssemblyObject::solve(bool enableRedo)
     }
     catch (...) {
         Base::Console().Error("Solve failed\n");
+        invalidateMbdAssembly();
         return -1;
     }
 
-    setNewPlacements();
+    std::set<App::DocumentObject*> movedParts = setNewPlacements();
 
-    redrawJointPlacements(joints);
+    if (rebuild) {
+        // A joint may have changed without any of its parts moving
+        redrawJointPlacements(joints);
+    }
+    else {
+        redrawJointPlacements(getJointsOfParts(joints, movedParts));
+    }
 
     return 0;
 }
 
-void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
+bool AssemblyObject::isMbdAssemblyUpToDate(
+    const std::vector<App::DocumentObject*>& groundedJoints,
+    const std::vector<App::DocumentObject*>& joints) const
 {
-    solve();
-
-    dragMbdParts.clear();
-    for (auto part : dragParts) {
-        dragMbdParts.push_back(getMbDPart(part));
+    if (!mbdAssemblyValid || !mbdAssembly
+        || mbdJointStates.size() != groundedJoints.size() + joints.size()) {
+        return false;
     }
 
-    mbdAssembly->runPreDrag();
+    auto isSameReference = [](const ReferenceState& state, const ReferenceState& current) {
+        // The relative placement is recomputed from the moved parts, so allow for
+        // rounding. A recomputed object gets a new shape, moving it only changes the
+        // location of the shape.
+        return state.obj == current.obj
+            && state.placement.isSame(current.placement, Precision::Confusion())
+            && state.shape.IsPartner(current.shape);
+    };
+    auto isSameJoint = [&isSameReference](const JointState& state, App::DocumentObject* joint) {
+        if (state.joint != joint) {
+            return false;
+        }
+        for (auto& [name, copy] : state.props) {
+            App::Property* prop = joint->getPropertyByName(name);
+            if (!prop || !prop->isSame(*copy)) {
+                return false;
+            }
+        }
+        return isSameReference(state.refs[0], getReferenceState(joint, "Object1", "Part1"))
+            && isSameReference(state.refs[1], getReferenceState(joint, "Object2", "Part2"));
+    };
+
+    std::size_t i = 0;
+    for (auto* joint : groundedJoints) {
+        if (!isSameJoint(mbdJointStates[i++], joint)) {
+            return false;
+        }
+    }
+    for (auto* joint : joints) {
+        if (!isSameJoint(mbdJointStates[i++], joint)) {
+            return false;
+        }
+    }
+    return true;
 }
 
-void AssemblyObject::doDragStep()
+void AssemblyObject::saveMbdAssemblyState(const std::vector<App::DocumentObject*>& groundedJoints,
+                                          const std::vector<App::DocumentObject*>& joints)
 {
-    for (auto& mbdPart : dragMbdParts) {
-        App::DocumentObject* part = nullptr;
-        for (auto& pair : objectPartMap) {
-            if (pair.second == mbdPart) {
-                part = pair.first;
-                break;
+    mbdJointStates.clear();
+    mbdJointStates.reserve(groundedJoints.size() + joints.size());
+
+    auto saveJoint = [this](App::DocumentObject* joint) {
+        JointState state;
+        state.joint = joint;
+        for (const char* name : solverJointProperties) {
+            if (App::Property* prop = joint->getPropertyByName(name)) {
+                state.props.emplace_back(name, std::unique_ptr<App::Property>(prop->Copy()));
             }
         }
-        if (!part) {
+        state.refs[0] = getReferenceState(joint, "Object1", "Part1");
+        state.refs[1] = getReferenceState(joint, "Object2", "Part2");
+        mbdJointStates.push_back(std::move(state));
+    };
+
+    for (auto* joint : groundedJoints) {
+        saveJoint(joint);
+    }
+    for (auto* joint : joints) {
+        saveJoint(joint);
+    }
+
+    mbdJoints = joints;
+    mbdAssemblyValid = true;
+}
+
+AssemblyObject::ReferenceState AssemblyObject::getReferenceState(App::DocumentObject* joint,
+                                                                 const char* pObjName,
+                                                                 const char* pPart)
+{
+    ReferenceState state {};
+    App::DocumentObject* part = getLinkObjFromProp(joint, pPart);
+    state.obj = getObjFromNameProp(joint, pObjName, pPart);
+    if (!part || !state.obj) {
+        return state;
+    }
+
+    // Same as the relative placement used by handleOneSideOfJoint()
+    if (state.obj != part) {
+        state.placement = getGlobalPlacement(part).inverse() * getGlobalPlacement(state.obj, part);
+    }
+
+    auto* linked = state.obj->getLinkedObject(true);
+    if (auto* feature = dynamic_cast<PartApp::Feature*>(linked)) {
+        state.shape = feature->Shape.getShape().getShape();
+    }
+    return state;
+}
+
+void AssemblyObject::invalidateMbdAssembly()
+{
+    mbdAssemblyValid = false;
+    mbdJointStates.clear();
+    mbdJoints.clear();
+    dragParts.clear();
+    dragMbdParts.reset();
+}
+
+void AssemblyObject::updateMbdPartPlacements()
+{
+    for (auto& [obj, mbdPart] : objectPartMap) {
+        setMbdPartPlacement(mbdPart, getPlacementFromProp(obj, "Placement"));
+    }
+}
+
+void AssemblyObject::preDrag(std::vector<App::DocumentObject*> parts)
+{
+    dragParts.clear();
+    dragMbdParts.reset();
+
+    if (solve() != 0) {
+        return;
+    }
+
+    dragMbdParts = std::make_shared<std::vector<std::shared_ptr<ASMTPart>>>();
+    for (auto part : parts) {
+        // Parts that are not in the solver model are not constrained by any joint. They are
+        // not added to it here, or the model would no longer match the one solve() built.
+        auto it = objectPartMap.find(part);
+        if (it == objectPartMap.end()) {
             continue;
         }
+        dragParts.emplace_back(part, it->second);
+        dragMbdParts->push_back(it->second);
+    }
 
-        Base::Placement plc = getPlacementFromProp(part, "Placement");
-        Base::Vector3d pos = plc.getPosition();
-        mbdPart->setPosition3D(pos.x, pos.y, pos.z);
+    try {
+        mbdAssembly->runPreDrag();
+    }
+    catch (...) {
+        Base::Console().Error("Drag failed\n");
+        invalidateMbdAssembly();
+    }
+}
 
-        Base::Rotation rot = plc.getRotation();
-        Base::Matrix4D mat;
-        rot.getValue(mat);
-        Base::Vector3d r0 = mat.getRow(0);
-        Base::Vector3d r1 = mat.getRow(1);
-        Base::Vector3d r2 = mat.getRow(2);
-        mbdPart->setRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+void AssemblyObject::doDragStep()
+{
+    if (!mbdAssemblyValid || !dragMbdParts) {
+        return;
+    }
+
+    for (auto& [part, mbdPart] : dragParts) {
+        setMbdPartPlacement(mbdPart, getPlacementFromProp(part, "Placement"));
     }
 
-    auto dragPartsVec = std::make_shared<std::vector<std::shared_ptr<ASMTPart>>>(dragMbdParts);
-    mbdAssembly->runDragStep(dragPartsVec);
-    setNewPlacements();
-    redrawJointPlacements(getJoints());
+    try {
+        mbdAssembly->runDragStep(dragMbdParts);
+    }
+    catch (...) {
+        Base::Console().Error("Drag failed\n");
+        invalidateMbdAssembly();
+        return;
+    }
+    std::set<App::DocumentObject*> movedParts = setNewPlacements();
+    redrawJointPlacements(getJointsOfParts(mbdJoints, movedParts));
 }
 
 void AssemblyObject::postDrag()
 {
-    mbdAssembly->runPostDrag();  // Do this after last drag
+    if (!mbdAssemblyValid || !dragMbdParts) {
+        return;
+    }
+
+    try {
+        mbdAssembly->runPostDrag();  // Do this after last drag
+    }
+    catch (...) {
+        Base::Console().Error("Drag failed\n");
+        invalidateMbdAssembly();
+        return;
+    }
+    dragParts.clear();
+    dragMbdParts.reset();
 }
 
 void AssemblyObject::savePlacementsForUndo()
@@ -245,6 +438,7 @@ void AssemblyObject::clearUndo()
 
 void AssemblyObject::exportAsASMT(std::string fileName)
 {
+    invalidateMbdAssembly();
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     fixGroundedParts();
@@ -256,8 +450,10 @@ void AssemblyObject::exportAsASMT(std::string fileName)
     mbdAssembly->outputFile(fileName);
 }
 
-void AssemblyObject::setNewPlacements()
+std::set<App::DocumentObject*> AssemblyObject::setNewPlacements()
 {
+    std::set<App::DocumentObject*> movedParts;
+
     for (auto& pair : objectPartMap) {
         App::DocumentObject* obj = pair.first;
         std::shared_ptr<ASMTPart> mbdPart = pair.second;
@@ -297,8 +493,13 @@ void AssemblyObject::setNewPlacements()
 
         Base::Placement newPlacement = Base::Placement(pos, rot);
 
-        propPlacement->setValue(newPlacement);
+        if (!propPlacement->getValue().isSame(newPlacement, Precision::Confusion())) {
+            propPlacement->setValue(newPlacement);
+            movedParts.insert(obj);
+        }
     }
+
+    return movedParts;
 }
 
 void AssemblyObject::redrawJointPlacements(std::vector<App::DocumentObject*> joints)
@@ -318,6 +519,25 @@ void AssemblyObject::redrawJointPlacements(std::vector<App::DocumentObject*> joi
     }
 }
 
+std::vector<App::DocumentObject*>
+AssemblyObject::getJointsOfParts(const std::vector<App::DocumentObject*>& joints,
+                                 const std::set<App::DocumentObject*>& parts)
+{
+    std::vector<App::DocumentObject*> jointsOfParts;
+    if (parts.empty()) {
+        return jointsOfParts;
+    }
+
+    for (auto* joint : joints) {
+        App::DocumentObject* part1 = getLinkObjFromProp(joint, "Part1");
+        App::DocumentObject* part2 = getLinkObjFromProp(joint, "Part2");
+        if (parts.count(part1) > 0 || parts.count(part2) > 0) {
+            jointsOfParts.push_back(joint);
+        }
+    }
+    return jointsOfParts;
+}
+
 void AssemblyObject::recomputeJointPlacements(std::vector<App::DocumentObject*> joints)
 {
     // The Placement1 and Placement2 of each joint needs to be updated as the parts moved.
@@ -1129,21 +1349,7 @@ AssemblyObject::makeMbdPart(std::string& name, Base::Placement plc, double mass)
     massMarker->setMomentOfInertias(1.0, 1.0, 1.0);
     mbdPart->setPrincipalMassMarker(massMarker);
 
-    Base::Vector3d pos = plc.getPosition();
-    mbdPart->setPosition3D(pos.x, pos.y, pos.z);
-    // Base::Console().Warning("MbD Part placement : (%f, %f, %f)\n", pos.x, pos.y, pos.z);
-
-    // TODO : replace with quaternion to simplify
-    Base::Rotation rot = plc.getRotation();
-    Base::Matrix4D mat;
-    rot.getValue(mat);
-    Base::Vector3d r0 = mat.getRow(0);
-    Base::Vector3d r1 = mat.getRow(1);
-    Base::Vector3d r2 = mat.getRow(2);
-    mbdPart->setRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
-    /*double q0, q1, q2, q3;
-    rot.getValue(q0, q1, q2, q3);
-    mbdPart->setQuarternions(q0, q1, q2, q3);*/
+    setMbdPartPlacement(mbdPart, plc);
 
     return mbdPart;
 }
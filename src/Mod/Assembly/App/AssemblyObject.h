@@ -26,14 +26,18 @@
 #define ASSEMBLY_AssemblyObject_H
 
 
+#include <array>
+
 #include <GeomAbs_CurveType.hxx>
 #include <GeomAbs_SurfaceType.hxx>
+#include <TopoDS_Shape.hxx>
 
 #include <Mod/Assembly/AssemblyGlobal.h>
 
 #include <App/FeaturePython.h>
 #include <App/Part.h>
 #include <App/PropertyLinks.h>
+#include <Base/Placement.h>
 
 namespace MbD
 {
@@ -87,7 +91,7 @@ public:
     and redraw the joints Args : enableRedo : This store initial positions to enable undo while
     being in an active transaction (joint creation).*/
     int solve(bool enableRedo = false);
-    void preDrag(std::vector<App::DocumentObject*> dragParts);
+    void preDrag(std::vector<App::DocumentObject*> parts);
     void doDragStep();
     void postDrag();
     void savePlacementsForUndo();
@@ -96,9 +100,14 @@ public:
 
     void exportAsASMT(std::string fileName);
 
-    void setNewPlacements();
+    /* Sets the placements of the parts from the solver results and returns the parts whose
+    placement actually changed.*/
+    std::set<App::DocumentObject*> setNewPlacements();
     void recomputeJointPlacements(std::vector<App::DocumentObject*> joints);
     void redrawJointPlacements(std::vector<App::DocumentObject*> joints);
+    std::vector<App::DocumentObject*>
+    getJointsOfParts(const std::vector<App::DocumentObject*>& joints,
+                     const std::set<App::DocumentObject*>& parts);
 
 
     // Ondsel Solver interface
@@ -155,11 +164,43 @@ public:
 
 
 private:
+    // The solver model is kept between solves and only rebuilt if the joints changed.
+    // These functions keep track of the joint properties the model was built from.
+    bool isMbdAssemblyUpToDate(const std::vector<App::DocumentObject*>& groundedJoints,
+                               const std::vector<App::DocumentObject*>& joints) const;
+    void saveMbdAssemblyState(const std::vector<App::DocumentObject*>& groundedJoints,
+                              const std::vector<App::DocumentObject*>& joints);
+    void updateMbdPartPlacements();
+    // Forces a rebuild on the next solve and ends any drag in progress
+    void invalidateMbdAssembly();
+
+    // An object referenced by a joint. The markers are placed relative to the part it
+    // belongs to, and the geometry of the referenced elements is read from its shape.
+    struct ReferenceState
+    {
+        App::DocumentObject* obj;
+        Base::Placement placement;
+        TopoDS_Shape shape;
+    };
+    static ReferenceState
+    getReferenceState(App::DocumentObject* joint, const char* pObjName, const char* pPart);
+
+    struct JointState
+    {
+        App::DocumentObject* joint;
+        std::vector<std::pair<const char*, std::unique_ptr<App::Property>>> props;
+        std::array<ReferenceState, 2> refs;
+    };
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
+    bool mbdAssemblyValid {false};
+    std::vector<JointState> mbdJointStates;
+    std::vector<App::DocumentObject*> mbdJoints;
 
     std::unordered_map<App::DocumentObject*, std::shared_ptr<MbD::ASMTPart>> objectPartMap;
     std::vector<std::pair<App::DocumentObject*, double>> objMasses;
-    std::vector<std::shared_ptr<MbD::ASMTPart>> dragMbdParts;
+    std::vector<std::pair<App::DocumentObject*, std::shared_ptr<MbD::ASMTPart>>> dragParts;
+    std::shared_ptr<std::vector<std::shared_ptr<MbD::ASMTPart>>> dragMbdParts;
 
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
 
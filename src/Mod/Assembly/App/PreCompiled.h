@@ -33,10 +33,12 @@
 #ifdef _PreComp_
 
 // standard
+#include <array>
 #include <cinttypes>
 #include <cmath>
 #include <iomanip>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -46,6 +48,7 @@
 #include <BRepAdaptor_Surface.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
+#include <Precision.hxx>
 
 #endif  // _PreComp_
 #endif  // ASSEMBLY_PRECOMPILED_H
@@ -24,6 +24,8 @@
 
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -46,6 +48,8 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/FacetBVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -490,6 +494,8 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
         if (xp.More()) {
             distss->LoadS1(xp.Current());
             isSolid = true;
+            // setting up the classifier is expensive, so do it only once
+            classifier = std::make_unique<BRepClass3d_SolidClassifier>(_rShape);
         }
     }
     // distss->SetDeflection(radius);
@@ -528,9 +534,8 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
 {
     const Standard_Real tol = 0.001;
-    BRepClass3d_SolidClassifier classifier(_rShape);
-    classifier.Perform(pnt3d, tol);
-    return (classifier.State() == TopAbs_IN);
+    classifier->Perform(pnt3d, tol);
+    return (classifier->State() == TopAbs_IN);
 }
 
 bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
@@ -560,6 +565,92 @@ bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
 
 // ----------------------------------------------------------------
 
+InspectNominalTessellatedShape::InspectNominalTessellatedShape(const TopoDS_Shape& shape,
+                                                               float offset,
+                                                               double deflection,
+                                                               bool refine)
+    : _rShape(shape)
+    , searchRadius(offset)
+    , maxDeviation(static_cast<float>(deflection))
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Data::ComplexGeoData::Facet> faces;
+    Part::TopoShape(shape).getFaces(points, faces, deflection);
+
+    facets.reserve(faces.size());
+    for (const auto& it : faces) {
+        facets.emplace_back(Base::toVector<float>(points[it.I1]),
+                            Base::toVector<float>(points[it.I2]),
+                            Base::toVector<float>(points[it.I3]));
+        // compute the normal now so that the queries only read it
+        facets.back().GetNormal();
+    }
+    bvh = std::make_unique<MeshCore::FacetBVH>(facets, 4);
+
+    // without a tessellation only the exact algorithm can be used
+    refineExact = refine || facets.empty();
+}
+
+InspectNominalTessellatedShape::~InspectNominalTessellatedShape() = default;
+
+const InspectNominalShape& InspectNominalTessellatedShape::getExactShape() const
+{
+    std::lock_guard<std::mutex> lock(exactMutex);
+    auto& shape = exact[std::this_thread::get_id()];
+    if (!shape) {
+        shape = std::make_unique<InspectNominalShape>(_rShape, searchRadius);
+    }
+    return *shape;
+}
+
+float InspectNominalTessellatedShape::getSignedDistance(const Base::Vector3f& point) const
+{
+    constexpr float epsilon = 1e-6F;
+    float minDist = FLT_MAX;
+    float bestDot = 0.0F;
+
+    bvh->Nearest(point, [&](MeshCore::FacetIndex index) {
+        const MeshCore::MeshGeomFacet& facet = facets[index];
+        Base::Vector3f nearest;
+        float dist = facet.DistanceToPoint(point, nearest);
+        if (dist > minDist * (1.0F + epsilon) + epsilon) {
+            return dist;
+        }
+
+        // If the nearest point lies on an edge or a corner the same distance is
+        // found for several triangles. Then the triangle whose normal is most
+        // parallel to the offset decides the side.
+        Base::Vector3f dir = point - nearest;
+        float len = dir.Length();
+        float dot = len > 0.0F ? (dir * facet.GetNormal()) / len : 1.0F;
+        if (dist < minDist * (1.0F - epsilon) - epsilon || std::fabs(dot) > std::fabs(bestDot)) {
+            bestDot = dot;
+        }
+        minDist = std::min(minDist, dist);
+        return dist;
+    });
+
+    return bestDot < 0.0F ? -minDist : minDist;
+}
+
+float InspectNominalTessellatedShape::getDistance(const Base::Vector3f& point) const
+{
+    if (facets.empty()) {
+        return getExactShape().getDistance(point);
+    }
+
+    float fDist = getSignedDistance(point);
+
+    // the point may lie on either side of the search radius
+    if (refineExact && std::fabs(std::fabs(fDist) - searchRadius) <= maxDeviation) {
+        fDist = getExactShape().getDistance(point);
+    }
+
+    return fDist;
+}
+
+// ----------------------------------------------------------------
+
 TYPESYSTEM_SOURCE(Inspection::PropertyDistanceList, App::PropertyLists)
 
 PropertyDistanceList::PropertyDistanceList() = default;
@@ -774,6 +865,18 @@ Feature::Feature()
     ADD_PROPERTY(Actual, (nullptr));
     ADD_PROPERTY(Nominals, (nullptr));
     ADD_PROPERTY(Distances, (0.0));
+    ADD_PROPERTY_TYPE(Deflection,
+                      (0.0),
+                      nullptr,
+                      App::Prop_None,
+                      "Tessellate nominal shapes with this deflection to speed up the inspection.\n"
+                      "If zero the distances are computed with the exact geometry.");
+    ADD_PROPERTY_TYPE(RefineExact,
+                      (false),
+                      nullptr,
+                      App::Prop_None,
+                      "Compute the distances of points close to the search radius with the exact\n"
+                      "geometry when tessellating nominal shapes.");
 }
 
 Feature::~Feature() = default;
@@ -792,6 +895,9 @@ short Feature::mustExecute() const
     if (Nominals.isTouched()) {
         return 1;
     }
+    if (Deflection.isTouched() || RefineExact.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
@@ -837,9 +943,15 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            if (this->Deflection.getValue() > 0.0) {
+                nominal = new InspectNominalTessellatedShape(part->Shape.getValue(), this->SearchRadius.getValue(),
+                                                             this->Deflection.getValue(), this->RefineExact.getValue());
+            }
+            else {
+                useMultithreading = false;
+                nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            }
         }
 
         if (nominal) {
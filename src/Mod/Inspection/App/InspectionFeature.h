@@ -23,19 +23,29 @@
 #ifndef INSPECTION_FEATURE_H
 #define INSPECTION_FEATURE_H
 
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
+#include <App/PropertyStandard.h>
 
 #include <Mod/Inspection/InspectionGlobal.h>
 #include <Mod/Points/App/Points.h>
 
 
 class TopoDS_Shape;
+class BRepClass3d_SolidClassifier;
 class BRepExtrema_DistShapeShape;
 class gp_Pnt;
 
 namespace MeshCore
 {
+class FacetBVH;
+class MeshGeomFacet;
 class MeshKernel;
 class MeshGrid;
 }  // namespace MeshCore
@@ -172,10 +182,44 @@ private:
 
 private:
     BRepExtrema_DistShapeShape* distss;
+    std::unique_ptr<BRepClass3d_SolidClassifier> classifier;
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
 
+/**
+ * Calculates the distances to a shape using its tessellation.
+ * The triangles are kept in a bounding volume hierarchy so that the queries
+ * are fast and can be done concurrently. The result differs from the exact
+ * distance by at most the deflection of the tessellation. If \a refine is
+ * true then points whose distance is that close to the search radius that they
+ * might fall on the other side of it are re-computed with the exact geometry.
+ * Shapes without faces are always computed exactly.
+ */
+class InspectionExport InspectNominalTessellatedShape: public InspectNominalGeometry
+{
+public:
+    InspectNominalTessellatedShape(const TopoDS_Shape&, float offset, double deflection, bool refine);
+    ~InspectNominalTessellatedShape() override;
+    float getDistance(const Base::Vector3f&) const override;
+    /// Returns the distance to the nearest triangle, negative on its back side
+    float getSignedDistance(const Base::Vector3f&) const;
+
+private:
+    const InspectNominalShape& getExactShape() const;
+
+private:
+    const TopoDS_Shape& _rShape;
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    std::unique_ptr<MeshCore::FacetBVH> bvh;
+    // BRepExtrema_DistShapeShape keeps its results, so each thread uses its own instance
+    mutable std::unordered_map<std::thread::id, std::unique_ptr<InspectNominalShape>> exact;
+    mutable std::mutex exactMutex;
+    float searchRadius;
+    float maxDeviation;
+    bool refineExact;
+};
+
 class InspectionExport PropertyDistanceList: public App::PropertyLists
 {
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
@@ -255,6 +299,8 @@ public:
     App::PropertyLink Actual;
     App::PropertyLinkList Nominals;
     PropertyDistanceList Distances;
+    App::PropertyFloat Deflection;
+    App::PropertyBool RefineExact;
     //@}
 
     /** @name Actions */
@@ -35,6 +35,8 @@
 #ifdef _PreComp_
 
 // STL
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
 // OCC
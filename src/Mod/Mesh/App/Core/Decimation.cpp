@@ -21,6 +21,16 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <unordered_map>
+#endif
+
+#include <QFuture>
+#include <QThread>
+#include <QtConcurrentMap>
 
 #include "Decimation.h"
 #include "MeshKernel.h"
@@ -29,125 +39,273 @@
 
 using namespace MeshCore;
 
-MeshSimplify::MeshSimplify(MeshKernel& mesh)
-    : myKernel(mesh)
-{}
+namespace
+{
+// Minimum number of facets of a partition for the parallel mode
+constexpr std::size_t minPartitionSize = 50000;
 
-void MeshSimplify::simplify(float tolerance, float reduction)
+void addVertex(Simplify& alg, const Base::Vector3f& pnt, bool locked)
+{
+    Simplify::Vertex v;
+    v.tstart = 0;
+    v.tcount = 0;
+    v.border = 0;
+    v.locked = locked ? 1 : 0;
+    v.p = pnt;
+    alg.vertices.push_back(v);
+}
+
+void addTriangle(Simplify& alg, int v0, int v1, int v2)
+{
+    Simplify::Triangle t;
+    t.deleted = 0;
+    t.dirty = 0;
+    for (double& j : t.err) {
+        j = 0.0;
+    }
+    t.v[0] = v0;
+    t.v[1] = v1;
+    t.v[2] = v2;
+    alg.triangles.push_back(t);
+}
+
+struct Partition
 {
+    std::vector<FacetIndex> facets;
+    // The points shared with other partitions. They are locked and get the first
+    // vertex indices which they keep after simplification.
+    std::vector<PointIndex> seam;
     Simplify alg;
+};
 
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+/**
+ * Splits the facets into partitions by recursively bisecting them at the median of
+ * the longest axis of their centers. Stops if there are enough partitions for the
+ * available threads or if the partitions would become too small.
+ */
+std::vector<Partition> createPartitions(const MeshPointArray& points,
+                                        const MeshFacetArray& facets)
+{
+    std::vector<Base::Vector3f> centers;
+    centers.reserve(facets.size());
+    for (const auto& face : facets) {
+        centers.push_back((points[face._aulPoints[0]] + points[face._aulPoints[1]]
+                           + points[face._aulPoints[2]])
+                          / 3.0F);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+    std::vector<FacetIndex> indices(facets.size());
+    std::iota(indices.begin(), indices.end(), 0);
+
+    auto numThreads = static_cast<std::size_t>(std::max(1, QThread::idealThreadCount()));
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    ranges.emplace_back(0, facets.size());
+    while (ranges.size() < numThreads
+           && facets.size() / (2 * ranges.size()) >= minPartitionSize) {
+        std::vector<std::pair<std::size_t, std::size_t>> next;
+        for (const auto& it : ranges) {
+            Base::BoundBox3f box;
+            for (std::size_t i = it.first; i < it.second; i++) {
+                box.Add(centers[indices[i]]);
+            }
+
+            int axis = 0;
+            if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+                axis = 1;
+            }
+            else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+                axis = 2;
+            }
+
+            std::size_t middle = it.first + (it.second - it.first) / 2;
+            std::nth_element(indices.begin() + it.first,
+                             indices.begin() + middle,
+                             indices.begin() + it.second,
+                             [&centers, axis](FacetIndex a, FacetIndex b) {
+                                 return centers[a][axis] < centers[b][axis];
+                             });
+            next.emplace_back(it.first, middle);
+            next.emplace_back(middle, it.second);
         }
-        alg.triangles.push_back(t);
+        ranges.swap(next);
     }
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0f - reduction));
+    std::vector<Partition> partitions(ranges.size());
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+        partitions[i].facets.assign(indices.begin() + ranges[i].first,
+                                    indices.begin() + ranges[i].second);
+    }
+    return partitions;
+}
 
-    // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+/**
+ * Simplifies the partitions in parallel and merges them into \a alg. The points on
+ * the seams between partitions are locked and only simplified by the final pass
+ * over the merged mesh.
+ */
+void simplifyPartitions(Simplify& alg,
+                        const MeshKernel& kernel,
+                        std::vector<Partition>& partitions,
+                        int targetSize,
+                        double tolerance)
+{
+    const MeshPointArray& points = kernel.GetPoints();
+    const MeshFacetArray& facets = kernel.GetFacets();
 
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+    // Find the points that are shared by several partitions
+    const int seamPoint = -2;
+    std::vector<int> owner(points.size(), -1);
+    for (std::size_t i = 0; i < partitions.size(); i++) {
+        int part = static_cast<int>(i);
+        for (FacetIndex index : partitions[i].facets) {
+            for (PointIndex pnt : facets[index]._aulPoints) {
+                if (owner[pnt] == -1) {
+                    owner[pnt] = part;
+                }
+                else if (owner[pnt] != part) {
+                    owner[pnt] = seamPoint;
+                }
+            }
+        }
     }
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
+    // Each point that is not on a seam belongs to exactly one partition, so the
+    // threads write to different elements of this array
+    std::vector<int> localIndex(points.size(), -1);
+    double ratio = static_cast<double>(targetSize) / static_cast<double>(facets.size());
+
+    std::function<void(Partition&)> simplifyPart = [&](Partition& part) {
+        Simplify& local = part.alg;
+        std::unordered_map<PointIndex, int> seamIndex;
+        for (FacetIndex index : part.facets) {
+            for (PointIndex pnt : facets[index]._aulPoints) {
+                if (owner[pnt] == seamPoint
+                    && seamIndex.emplace(pnt, static_cast<int>(part.seam.size())).second) {
+                    part.seam.push_back(pnt);
+                    addVertex(local, points[pnt], true);
+                }
+            }
         }
-    }
-    MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
+
+        local.triangles.reserve(part.facets.size());
+        for (FacetIndex index : part.facets) {
+            int v[3];
+            for (int j = 0; j < 3; j++) {
+                PointIndex pnt = facets[index]._aulPoints[j];
+                if (owner[pnt] == seamPoint) {
+                    v[j] = seamIndex[pnt];
+                }
+                else {
+                    if (localIndex[pnt] < 0) {
+                        localIndex[pnt] = static_cast<int>(local.vertices.size());
+                        addVertex(local, points[pnt], false);
+                    }
+                    v[j] = localIndex[pnt];
+                }
+            }
+            addTriangle(local, v[0], v[1], v[2]);
+        }
+
+        auto target = static_cast<int>(static_cast<double>(part.facets.size()) * ratio);
+        local.simplify_mesh(target, tolerance);
+    };
+
+    QFuture<void> future = QtConcurrent::map(partitions, simplifyPart);
+    future.waitForFinished();
+
+    // Merge the partitions, the seam points are shared again
+    std::vector<int>& mergedIndex = localIndex;
+    std::fill(mergedIndex.begin(), mergedIndex.end(), -1);
+    for (auto& part : partitions) {
+        std::vector<int> vertexMap(part.alg.vertices.size());
+        for (std::size_t i = 0; i < vertexMap.size(); i++) {
+            if (i < part.seam.size()) {
+                PointIndex pnt = part.seam[i];
+                if (mergedIndex[pnt] < 0) {
+                    mergedIndex[pnt] = static_cast<int>(alg.vertices.size());
+                    addVertex(alg, points[pnt], false);
+                }
+                vertexMap[i] = mergedIndex[pnt];
+            }
+            else {
+                vertexMap[i] = static_cast<int>(alg.vertices.size());
+                addVertex(alg, part.alg.vertices[i].p, false);
+            }
         }
+
+        for (const auto& triangle : part.alg.triangles) {
+            addTriangle(alg,
+                        vertexMap[triangle.v[0]],
+                        vertexMap[triangle.v[1]],
+                        vertexMap[triangle.v[2]]);
+        }
+
+        part.alg = Simplify();
     }
+}
+}  // namespace
 
-    myKernel.Adopt(new_points, new_facets, true);
+MeshSimplify::MeshSimplify(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0f - reduction));
+    simplifyMesh(target_count, tolerance);
 }
 
 void MeshSimplify::simplify(int targetSize)
+{
+    simplifyMesh(targetSize, FLT_MAX);
+}
+
+void MeshSimplify::simplifyMesh(int targetSize, double tolerance)
 {
     Simplify alg;
 
     const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+    const MeshFacetArray& facets = myKernel.GetFacets();
+
+    std::vector<Partition> partitions;
+    if (parallel && facets.size() >= 2 * minPartitionSize) {
+        partitions = createPartitions(points, facets);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
+    if (partitions.size() > 1) {
+        simplifyPartitions(alg, myKernel, partitions, targetSize, tolerance);
+    }
+    else {
+        alg.vertices.reserve(points.size());
+        for (const auto& pnt : points) {
+            addVertex(alg, pnt, false);
         }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
+
+        alg.triangles.reserve(facets.size());
+        for (const auto& face : facets) {
+            addTriangle(alg, face._aulPoints[0], face._aulPoints[1], face._aulPoints[2]);
         }
-        alg.triangles.push_back(t);
     }
 
     // Simplification starts
-    alg.simplify_mesh(targetSize, FLT_MAX);
+    alg.simplify_mesh(targetSize, tolerance);
 
-    // Simplification done
+    // Simplification done, deleted triangles and unused vertices are already removed
     MeshPointArray new_points;
     new_points.reserve(alg.vertices.size());
     for (const auto& vertex : alg.vertices) {
         new_points.push_back(vertex.p);
     }
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
-        }
-    }
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
+    new_facets.reserve(alg.triangles.size());
     for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
-        }
+        MeshFacet face;
+        face._aulPoints[0] = triangle.v[0];
+        face._aulPoints[1] = triangle.v[1];
+        face._aulPoints[2] = triangle.v[2];
+        new_facets.push_back(face);
     }
 
     myKernel.Adopt(new_points, new_facets, true);
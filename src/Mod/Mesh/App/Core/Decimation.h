@@ -34,11 +34,25 @@ class MeshExport MeshSimplify
 {
 public:
     MeshSimplify(MeshKernel&);  // explicit bombs
+    /**
+     * Enables the parallel mode for large meshes. The mesh is split into spatial
+     * partitions which are simplified in separate threads while the points on the
+     * seams between them are kept. Afterwards a serial pass over the much smaller
+     * merged mesh simplifies the seams and reaches the requested size.
+     */
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
 
+private:
+    void simplifyMesh(int targetSize, double tolerance);
+
 private:
     MeshKernel& myKernel;
+    bool parallel {false};
 };
 
 }  // namespace MeshCore
@@ -24,15 +24,22 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <vector>
 #endif
 
+#include <QFuture>
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include <Base/Matrix.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Evaluation.h"
+#include "FacetBVH.h"
 #include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -598,83 +605,119 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
+bool ShareCommonPoint(const MeshFacet& face1, const MeshFacet& face2)
+{
+    for (PointIndex p1 : face1._aulPoints) {
+        for (PointIndex p2 : face2._aulPoints) {
+            if (p1 == p2) {
+                return true;
+            }
+        }
     }
+    return false;
+}
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
+/**
+ * Tests all pairs of facets with overlapping bounding boxes for intersections.
+ * Each pair is tested once, the facets are distributed over several threads and
+ * each thread collects its results separately. The blocks of facets are processed
+ * in batches so that the progress can be updated and the user can cancel in between.
+ */
+std::vector<std::pair<FacetIndex, FacetIndex>>
+FindSelfIntersections(const MeshKernel& kernel, bool firstOnly, bool canAbort)
+{
+    const MeshFacetArray& rFaces = kernel.GetFacets();
+    const MeshPointArray& rPoints = kernel.GetPoints();
+    std::size_t numFacets = rFaces.size();
 
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(numFacets);
+    for (const auto& face : rFaces) {
+        Base::BoundBox3f box;
+        for (PointIndex index : face._aulPoints) {
+            box.Add(rPoints[index]);
         }
+        boxes.push_back(box);
+    }
 
-        MeshGeomFacet facet1, facet2;
+    FacetBVH tree(boxes);
+    std::atomic<bool> found(false);
+
+    using FacetPairs = std::vector<std::pair<FacetIndex, FacetIndex>>;
+    using FacetRange = std::pair<FacetIndex, FacetIndex>;
+    std::function<FacetPairs(const FacetRange&)> check = [&](const FacetRange& range) {
+        FacetPairs result;
         Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
+        for (FacetIndex i = range.first; i < range.second; i++) {
+            if (firstOnly && found) {
+                break;
+            }
+            const MeshFacet& rface1 = rFaces[i];
+            MeshGeomFacet facet1 = kernel.GetFacet(rface1);
+            tree.Intersect(boxes[i], [&](FacetIndex j) {
+                // test each pair only once
+                if (j <= i) {
+                    return;
                 }
                 // If the facets share a common vertex we do not check for self-intersections
                 // because they could but usually do not intersect each other and the algorithm
                 // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+                const MeshFacet& rface2 = rFaces[j];
+                if (ShareCommonPoint(rface1, rface2)) {
+                    return;
                 }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+                if (!(boxes[i] && boxes[j])) {
+                    return;
                 }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+                MeshGeomFacet facet2 = kernel.GetFacet(rface2);
+                if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                    result.emplace_back(i, j);
+                    found = true;
                 }
+            });
+        }
+        return result;
+    };
+
+    // Use more blocks than threads because the work per facet differs a lot
+    std::size_t numBlocks = std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(numFacets / 1024, QThread::idealThreadCount() * 8));
+    std::vector<FacetRange> ranges;
+    for (std::size_t i = 0; i < numBlocks; i++) {
+        ranges.emplace_back(static_cast<FacetIndex>(i * numFacets / numBlocks),
+                            static_cast<FacetIndex>((i + 1) * numFacets / numBlocks));
+    }
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
-            }
+    FacetPairs intersection;
+    Base::SequencerLauncher seq("Checking for self-intersections...", numBlocks);
+    auto batchSize = static_cast<std::size_t>(std::max(1, QThread::idealThreadCount()));
+    for (std::size_t first = 0; first < numBlocks; first += batchSize) {
+        std::size_t last = std::min(first + batchSize, numBlocks);
+        std::vector<FacetRange> batch(ranges.begin() + first, ranges.begin() + last);
+        QFuture<FacetPairs> future = QtConcurrent::mapped(batch, check);
+        future.waitForFinished();
+        for (const auto& it : future) {
+            intersection.insert(intersection.end(), it.begin(), it.end());
+        }
+        if (firstOnly && found) {
+            break;
+        }
+        for (std::size_t i = first; i < last; i++) {
+            seq.next(canAbort);
         }
     }
+    std::sort(intersection.begin(), intersection.end());
+    return intersection;
+}
+}  // namespace
 
-    return true;
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    return FindSelfIntersections(_rclMesh, true, false).empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -705,79 +748,9 @@ void MeshEvalSelfIntersection::GetIntersections(
 void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (std::vector<FacetIndex>::iterator it = aulGridElements.begin();
-             it != aulGridElements.end();
-             ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (std::vector<FacetIndex>::iterator jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
-    }
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs =
+        FindSelfIntersections(_rclMesh, false, true);
+    intersection.insert(intersection.end(), pairs.begin(), pairs.end());
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <numeric>
+#endif
+
+#include "Elements.h"
+#include "FacetBVH.h"
+
+
+using namespace MeshCore;
+
+FacetBVH::FacetBVH(const std::vector<Base::BoundBox3f>& boxes, uint32_t maxLeafSize)
+{
+    Build(boxes, maxLeafSize);
+}
+
+FacetBVH::FacetBVH(const std::vector<MeshGeomFacet>& facets, uint32_t maxLeafSize)
+{
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(facets.size());
+    for (const auto& it : facets) {
+        boxes.push_back(it.GetBoundBox());
+    }
+    Build(boxes, maxLeafSize);
+}
+
+void FacetBVH::Build(const std::vector<Base::BoundBox3f>& boxes, uint32_t maxLeafSize)
+{
+    auto numFacets = static_cast<uint32_t>(boxes.size());
+    if (numFacets == 0) {
+        return;
+    }
+    maxLeafSize = std::max<uint32_t>(maxLeafSize, 1);
+
+    std::vector<Base::Vector3f> centers;
+    centers.reserve(numFacets);
+    for (const auto& box : boxes) {
+        centers.push_back(box.GetCenter());
+    }
+
+    facets.resize(numFacets);
+    std::iota(facets.begin(), facets.end(), 0);
+    nodes.reserve(2 * (numFacets / maxLeafSize + 1));
+
+    struct Range
+    {
+        uint32_t first;
+        uint32_t count;
+        uint32_t parent;
+        bool right;
+    };
+
+    std::vector<Range> todo;
+    todo.push_back({0, numFacets, 0, false});
+    while (!todo.empty()) {
+        Range range = todo.back();
+        todo.pop_back();
+
+        auto index = static_cast<uint32_t>(nodes.size());
+        if (range.right) {
+            nodes[range.parent].first = index;
+        }
+
+        nodes.emplace_back();
+        Node& node = nodes.back();
+        Base::BoundBox3f centerBox;
+        for (uint32_t i = range.first; i < range.first + range.count; i++) {
+            node.box.Add(boxes[facets[i]]);
+            centerBox.Add(centers[facets[i]]);
+        }
+
+        float dx = centerBox.LengthX();
+        float dy = centerBox.LengthY();
+        float dz = centerBox.LengthZ();
+        if (range.count <= maxLeafSize || std::max({dx, dy, dz}) <= 0.0F) {
+            node.first = range.first;
+            node.count = range.count;
+            continue;
+        }
+
+        // split at the median of the longest axis of the box centers
+        int axis = 0;
+        if (dy > dx && dy >= dz) {
+            axis = 1;
+        }
+        else if (dz > dx && dz > dy) {
+            axis = 2;
+        }
+
+        auto begin = facets.begin() + range.first;
+        auto middle = begin + range.count / 2;
+        auto end = begin + range.count;
+        std::nth_element(begin, middle, end, [&centers, axis](FacetIndex a, FacetIndex b) {
+            return centers[a][axis] < centers[b][axis];
+        });
+
+        uint32_t half = range.count / 2;
+        // the left child is pushed last and therefore handled first
+        todo.push_back({range.first + half, range.count - half, index, true});
+        todo.push_back({range.first, half, index, false});
+    }
+}
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#ifndef MESH_FACETBVH_H
+#define MESH_FACETBVH_H
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+class MeshGeomFacet;
+
+/**
+ * Bounding volume hierarchy over the bounding boxes of a set of facets.
+ *
+ * The hierarchy is built by median splits along the longest axis of the box
+ * centers. The nodes are stored in depth-first order, i.e. the left child of an
+ * inner node directly follows its parent. The queries don't modify the tree and
+ * may run concurrently. The facets themselves are not stored, the callbacks of
+ * the queries get their indices.
+ */
+class MeshExport FacetBVH
+{
+public:
+    /// Builds the hierarchy over one bounding box per facet
+    explicit FacetBVH(const std::vector<Base::BoundBox3f>& boxes, uint32_t maxLeafSize = 8);
+    /// Builds the hierarchy over the bounding boxes of \a facets
+    explicit FacetBVH(const std::vector<MeshGeomFacet>& facets, uint32_t maxLeafSize = 8);
+
+    bool IsEmpty() const
+    {
+        return nodes.empty();
+    }
+
+    /// Calls \a func for each facet of the leaves whose bounding box intersects \a box
+    template<typename Func>
+    void Intersect(const Base::BoundBox3f& box, Func&& func) const
+    {
+        if (nodes.empty()) {
+            return;
+        }
+
+        std::array<uint32_t, maxDepth> stack {};
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            uint32_t index = stack[--top];
+            const Node& node = nodes[index];
+            if (!(node.box && box)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    func(facets[i]);
+                }
+            }
+            else {
+                stack[top++] = node.first;
+                stack[top++] = index + 1;
+            }
+        }
+    }
+
+    /**
+     * Searches the facet nearest to \a point. \a distance is called with a facet
+     * index and returns the distance of that facet to \a point. Sub-trees farther
+     * away than the smallest distance so far are skipped and the nearer child of a
+     * node is visited first. Returns the smallest distance or FLT_MAX if empty.
+     */
+    template<typename Func>
+    float Nearest(const Base::Vector3f& point, Func&& distance) const
+    {
+        float minDist = FLT_MAX;
+        if (nodes.empty()) {
+            return minDist;
+        }
+
+        std::array<uint32_t, maxDepth> stack {};
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            uint32_t index = stack[--top];
+            const Node& node = nodes[index];
+            if (DistanceToBox(node.box, point) > minDist) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                    minDist = std::min(minDist, distance(facets[i]));
+                }
+            }
+            else {
+                uint32_t nearChild = index + 1;
+                uint32_t farChild = node.first;
+                if (DistanceToBox(nodes[farChild].box, point)
+                    < DistanceToBox(nodes[nearChild].box, point)) {
+                    std::swap(nearChild, farChild);
+                }
+                stack[top++] = farChild;
+                stack[top++] = nearChild;
+            }
+        }
+        return minDist;
+    }
+
+    static float DistanceToBox(const Base::BoundBox3f& box, const Base::Vector3f& point)
+    {
+        float dx = std::max({box.MinX - point.x, 0.0F, point.x - box.MaxX});
+        float dy = std::max({box.MinY - point.y, 0.0F, point.y - box.MaxY});
+        float dz = std::max({box.MinZ - point.z, 0.0F, point.z - box.MaxZ});
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+private:
+    void Build(const std::vector<Base::BoundBox3f>& boxes, uint32_t maxLeafSize);
+
+    // The median split keeps the depth at about log2(number of facets)
+    static constexpr std::size_t maxDepth = 64;
+
+    // Leaf nodes have count > 0 and first is the offset into the facet list.
+    // Inner nodes have count == 0 and first is the index of the right child.
+    struct Node
+    {
+        Base::BoundBox3f box;
+        uint32_t first {0};
+        uint32_t count {0};
+    };
+
+    std::vector<Node> nodes;
+    std::vector<FacetIndex> facets;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_FACETBVH_H
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#ifndef MESH_FLATKDTREE_H
+#define MESH_FLATKDTREE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include "Functional.h"
+
+
+namespace MeshCore
+{
+
+/**
+ * A static kd-tree over (point, index) pairs that is stored in a flat array.
+ *
+ * The tree is implicit: the node of the range [first, last) is stored at its
+ * middle, the left sub-tree in [first, mid) and the right one in [mid + 1, last).
+ * All points of the left sub-tree are not greater than the node along the
+ * split axis and all points of the right sub-tree are not less. The tree is
+ * built by median splits along the longest axis of each range.
+ *
+ * After Build() the queries don't modify the tree and may run concurrently.
+ * The class is header-only so that modules that don't link Mesh can use it.
+ */
+template<typename Index>
+class FlatKDTree
+{
+public:
+    struct Node
+    {
+        Base::Vector3f p;
+        Index i;
+    };
+
+    // Candidate of a nearest neighbour search, node is the position in the tree
+    struct Candidate
+    {
+        float dist2;
+        std::size_t node;
+
+        bool operator<(const Candidate& other) const
+        {
+            return dist2 < other.dist2;
+        }
+    };
+
+    static constexpr std::size_t NoNode = std::numeric_limits<std::size_t>::max();
+
+    void Clear()
+    {
+        nodes.clear();
+        axes.clear();
+    }
+    void Reserve(std::size_t size)
+    {
+        nodes.reserve(size);
+    }
+    /// Adds a point, the tree must be built again before the next query
+    void Add(const Base::Vector3f& p, Index i)
+    {
+        nodes.push_back({p, i});
+    }
+    std::size_t Size() const
+    {
+        return nodes.size();
+    }
+    bool IsEmpty() const
+    {
+        return nodes.empty();
+    }
+    const Node& GetNode(std::size_t pos) const
+    {
+        return nodes[pos];
+    }
+
+    void Build()
+    {
+        using NodeRange = std::pair<std::size_t, std::size_t>;
+        axes.assign(nodes.size(), 0);
+
+        // The sub-trees of the upper levels are independent and built in parallel
+        constexpr std::size_t minParallelSize = 50000;
+        std::vector<NodeRange> ranges;
+        ranges.emplace_back(0, nodes.size());
+        while (ranges.size() < 16 && nodes.size() / ranges.size() > minParallelSize) {
+            std::vector<NodeRange> next;
+            for (const auto& it : ranges) {
+                Split(it.first, it.second, next);
+            }
+            ranges.swap(next);
+        }
+
+        parallel_for(
+            ranges.size(),
+            [this, &ranges](std::size_t first, std::size_t last) {
+                std::vector<NodeRange> todo;
+                for (std::size_t i = first; i < last; i++) {
+                    todo.push_back(ranges[i]);
+                    while (!todo.empty()) {
+                        NodeRange range = todo.back();
+                        todo.pop_back();
+                        Split(range.first, range.second, todo);
+                    }
+                }
+            },
+            0,
+            1);
+    }
+
+    /// Nearest point with a distance of at most sqrt(best.dist2)
+    void Nearest(const Base::Vector3f& p, Candidate& best) const
+    {
+        Nearest(p, 0, nodes.size(), best);
+    }
+
+    /// The \a k nearest points, sorted by ascending distance
+    void KNearest(const Base::Vector3f& p, std::size_t k, std::vector<Candidate>& result) const
+    {
+        result.clear();
+        if (k > 0) {
+            KNearest(p, 0, nodes.size(), k, result);
+        }
+        std::sort_heap(result.begin(), result.end());
+    }
+
+    /// Appends the points inside the box of half size \a range around \a p, or inside the sphere
+    void Range(const Base::Vector3f& p, float range, bool sphere, std::vector<Index>& indices) const
+    {
+        Range(p, range, sphere, 0, nodes.size(), indices);
+    }
+
+private:
+    // Puts the median of [first, last) to the middle and adds the two halves to \a todo
+    void Split(std::size_t first,
+               std::size_t last,
+               std::vector<std::pair<std::size_t, std::size_t>>& todo)
+    {
+        if (last - first < 2) {
+            return;
+        }
+
+        // split along the longest side of the bounding box
+        Base::BoundBox3f box;
+        for (std::size_t i = first; i < last; i++) {
+            box.Add(nodes[i].p);
+        }
+        unsigned char axis = 0;
+        if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+            axis = 1;
+        }
+        else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+            axis = 2;
+        }
+
+        std::size_t mid = first + (last - first) / 2;
+        std::nth_element(nodes.begin() + static_cast<std::ptrdiff_t>(first),
+                         nodes.begin() + static_cast<std::ptrdiff_t>(mid),
+                         nodes.begin() + static_cast<std::ptrdiff_t>(last),
+                         [axis](const Node& a, const Node& b) {
+                             return a.p[axis] < b.p[axis];
+                         });
+        axes[mid] = axis;
+        todo.emplace_back(first, mid);
+        todo.emplace_back(mid + 1, last);
+    }
+
+    void Nearest(const Base::Vector3f& p,
+                 std::size_t first,
+                 std::size_t last,
+                 Candidate& best) const
+    {
+        while (first < last) {
+            std::size_t mid = first + (last - first) / 2;
+            const Node& node = nodes[mid];
+            float dist2 = Base::DistanceP2(node.p, p);
+            if (dist2 < best.dist2 || (best.node == NoNode && dist2 <= best.dist2)) {
+                best = {dist2, mid};
+            }
+
+            // search the side of the query point first, the other one only
+            // if it can contain a closer point
+            float diff = p[axes[mid]] - node.p[axes[mid]];
+            bool left = diff < 0.0F;
+            std::size_t farFirst = left ? mid + 1 : first;
+            std::size_t farLast = left ? last : mid;
+            Nearest(p, left ? first : mid + 1, left ? mid : last, best);
+            if (diff * diff > best.dist2) {
+                break;
+            }
+            first = farFirst;
+            last = farLast;
+        }
+    }
+
+    // Keeps the k nearest points in the max-heap \a heap
+    void KNearest(const Base::Vector3f& p,
+                  std::size_t first,
+                  std::size_t last,
+                  std::size_t k,
+                  std::vector<Candidate>& heap) const
+    {
+        while (first < last) {
+            std::size_t mid = first + (last - first) / 2;
+            const Node& node = nodes[mid];
+            float dist2 = Base::DistanceP2(node.p, p);
+            if (heap.size() < k) {
+                heap.push_back({dist2, mid});
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (dist2 < heap.front().dist2) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = {dist2, mid};
+                std::push_heap(heap.begin(), heap.end());
+            }
+
+            float diff = p[axes[mid]] - node.p[axes[mid]];
+            bool left = diff < 0.0F;
+            std::size_t farFirst = left ? mid + 1 : first;
+            std::size_t farLast = left ? last : mid;
+            KNearest(p, left ? first : mid + 1, left ? mid : last, k, heap);
+            if (heap.size() == k && diff * diff > heap.front().dist2) {
+                break;
+            }
+            first = farFirst;
+            last = farLast;
+        }
+    }
+
+    void Range(const Base::Vector3f& p,
+               float range,
+               bool sphere,
+               std::size_t first,
+               std::size_t last,
+               std::vector<Index>& indices) const
+    {
+        while (first < last) {
+            std::size_t mid = first + (last - first) / 2;
+            const Node& node = nodes[mid];
+            if (sphere) {
+                if (Base::DistanceP2(node.p, p) <= range * range) {
+                    indices.push_back(node.i);
+                }
+            }
+            else if (std::fabs(node.p.x - p.x) <= range && std::fabs(node.p.y - p.y) <= range
+                     && std::fabs(node.p.z - p.z) <= range) {
+                indices.push_back(node.i);
+            }
+
+            float diff = p[axes[mid]] - node.p[axes[mid]];
+            if (diff - range <= 0.0F && diff + range >= 0.0F) {
+                Range(p, range, sphere, first, mid, indices);
+                first = mid + 1;
+            }
+            else if (diff < 0.0F) {
+                last = mid;
+            }
+            else {
+                first = mid + 1;
+            }
+        }
+    }
+
+private:
+    std::vector<Node> nodes;
+    std::vector<unsigned char> axes;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_FLATKDTREE_H
@@ -24,8 +24,13 @@
 #define MESH_FUNCTIONAL_H
 
 #include <QFuture>
+#include <QThread>
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
 
 
 namespace MeshCore
@@ -56,6 +61,39 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/**
+ * Splits [0, count) into consecutive blocks and calls \a func(first, last) for each
+ * of them in a separate thread. A thread count of 0 uses all available cores.
+ * Blocks smaller than \a minBlockSize are not worth the overhead of a thread.
+ */
+inline void parallel_for(std::size_t count,
+                         const std::function<void(std::size_t, std::size_t)>& func,
+                         int threads = 0,
+                         std::size_t minBlockSize = 1024)
+{
+    int numThreads = threads > 0 ? threads : QThread::idealThreadCount();
+    std::size_t numBlocks =
+        std::min<std::size_t>(static_cast<std::size_t>(std::max(1, numThreads)),
+                              count / std::max<std::size_t>(1, minBlockSize));
+    if (numBlocks <= 1) {
+        func(0, count);
+        return;
+    }
+
+    using BlockRange = std::pair<std::size_t, std::size_t>;
+    std::vector<BlockRange> ranges;
+    ranges.reserve(numBlocks);
+    for (std::size_t i = 0; i < numBlocks; i++) {
+        ranges.emplace_back(i * count / numBlocks, (i + 1) * count / numBlocks);
+    }
+
+    std::function<void(BlockRange&)> run = [&func](BlockRange& range) {
+        func(range.first, range.second);
+    };
+    QFuture<void> future = QtConcurrent::map(ranges, run);
+    future.waitForFinished();
+}
+
 }  // namespace MeshCore
 
 
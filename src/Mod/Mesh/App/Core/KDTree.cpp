@@ -21,68 +21,52 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
-#ifdef _MSC_VER
-#pragma warning(disable : 4396)
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <mutex>
 #endif
 
+#include "FlatKDTree.h"
+#include "Functional.h"
 #include "KDTree.h"
-#include <kdtree++/kdtree.hpp>
 
 
 using namespace MeshCore;
 
-struct Point3d
+namespace
 {
-    using value_type = float;
+using Tree = FlatKDTree<PointIndex>;
+using Candidate = Tree::Candidate;
+}  // namespace
 
-    Point3d(const Base::Vector3f& f, PointIndex i)
-        : p(f)
-        , i(i)
-    {}
-
-    Point3d(const Point3d& pnt) = default;
-
-    Point3d(Point3d&& pnt)
-        : p(pnt.p)
-        , i(pnt.i)
-    {}
-
-    ~Point3d() = default;
-
-    inline value_type operator[](const int N) const
-    {
-        return p[N];
-    }
-
-    inline bool operator==(const Point3d& other) const
-    {
-        return (this->p) == (other.p);
-    }
+class MeshKDTree::Private
+{
+public:
+    Tree tree;
+    std::atomic<bool> dirty {false};
+    std::mutex mutex;
 
-    inline bool operator!=(const Point3d& other) const
+    void Add(const Base::Vector3f& point)
     {
-        return (this->p) != (other.p);
+        tree.Add(point, static_cast<PointIndex>(tree.Size()));
+        dirty = true;
     }
 
-    inline Point3d& operator=(const Point3d& other) = default;
-
-    inline Point3d& operator=(Point3d&& other)
+    // Builds the tree if points were added since the last call
+    void Prepare()
     {
-        this->p = other.p;
-        this->i = other.i;
-        return *this;
+        if (!dirty) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (dirty) {
+            tree.Build();
+            dirty = false;
+        }
     }
-
-    Base::Vector3f p;
-    PointIndex i;
-};
-
-using MyKDTree = KDTree::KDTree<3, Point3d>;
-
-class MeshKDTree::Private
-{
-public:
-    MyKDTree kd_tree;
 };
 
 MeshKDTree::MeshKDTree()
@@ -92,19 +76,15 @@ MeshKDTree::MeshKDTree()
 MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    AddPoints(points);
+    d->Prepare();
 }
 
 MeshKDTree::MeshKDTree(const MeshPointArray& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    AddPoints(points);
+    d->Prepare();
 }
 
 MeshKDTree::~MeshKDTree()
@@ -114,52 +94,44 @@ MeshKDTree::~MeshKDTree()
 
 void MeshKDTree::AddPoint(const Base::Vector3f& point)
 {
-    PointIndex index = d->kd_tree.size();
-    d->kd_tree.insert(Point3d(point, index));
+    d->Add(point);
 }
 
 void MeshKDTree::AddPoints(const std::vector<Base::Vector3f>& points)
 {
-    PointIndex index = d->kd_tree.size();
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
+    d->tree.Reserve(d->tree.Size() + points.size());
+    for (const auto& it : points) {
+        d->Add(it);
     }
 }
 
 void MeshKDTree::AddPoints(const MeshPointArray& points)
 {
-    PointIndex index = d->kd_tree.size();
+    d->tree.Reserve(d->tree.Size() + points.size());
     for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
+        d->Add(it);
     }
 }
 
 bool MeshKDTree::IsEmpty() const
 {
-    return d->kd_tree.empty();
+    return d->tree.IsEmpty();
 }
 
 void MeshKDTree::Clear()
 {
-    d->kd_tree.clear();
+    d->tree.Clear();
+    d->dirty = false;
 }
 
 void MeshKDTree::Optimize()
 {
-    d->kd_tree.optimize();
+    d->Prepare();
 }
 
 PointIndex MeshKDTree::FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float& dist) const
 {
-    std::pair<MyKDTree::const_iterator, MyKDTree::distance_type> it =
-        d->kd_tree.find_nearest(Point3d(p, 0));
-    if (it.first == d->kd_tree.end()) {
-        return POINT_INDEX_MAX;
-    }
-    PointIndex index = it.first->i;
-    n = it.first->p;
-    dist = it.second;
-    return index;
+    return FindNearest(p, FLT_MAX, n, dist);
 }
 
 PointIndex MeshKDTree::FindNearest(const Base::Vector3f& p,
@@ -167,35 +139,86 @@ PointIndex MeshKDTree::FindNearest(const Base::Vector3f& p,
                                    Base::Vector3f& n,
                                    float& dist) const
 {
-    std::pair<MyKDTree::const_iterator, MyKDTree::distance_type> it =
-        d->kd_tree.find_nearest(Point3d(p, 0), max_dist);
-    if (it.first == d->kd_tree.end()) {
+    d->Prepare();
+    Candidate best {max_dist < std::sqrt(FLT_MAX) ? max_dist * max_dist : FLT_MAX, Tree::NoNode};
+    d->tree.Nearest(p, best);
+    if (best.node == Tree::NoNode) {
         return POINT_INDEX_MAX;
     }
-    PointIndex index = it.first->i;
-    n = it.first->p;
-    dist = it.second;
-    return index;
+    const Tree::Node& node = d->tree.GetNode(best.node);
+    n = node.p;
+    dist = std::sqrt(best.dist2);
+    return node.i;
 }
 
 PointIndex MeshKDTree::FindExact(const Base::Vector3f& p) const
 {
-    MyKDTree::const_iterator it = d->kd_tree.find_exact(Point3d(p, 0));
-    if (it == d->kd_tree.end()) {
+    d->Prepare();
+    Candidate best {FLT_MAX, Tree::NoNode};
+    d->tree.Nearest(p, best);
+    if (best.node == Tree::NoNode || d->tree.GetNode(best.node).p != p) {
         return POINT_INDEX_MAX;
     }
-    PointIndex index = it->i;
-    return index;
+    return d->tree.GetNode(best.node).i;
 }
 
 void MeshKDTree::FindInRange(const Base::Vector3f& p,
                              float range,
                              std::vector<PointIndex>& indices) const
 {
-    std::vector<Point3d> v;
-    d->kd_tree.find_within_range(Point3d(p, 0), range, std::back_inserter(v));
-    indices.reserve(v.size());
-    for (const auto& it : v) {
-        indices.push_back(it.i);
+    d->Prepare();
+    std::size_t offset = indices.size();
+    d->tree.Range(p, range, false, indices);
+    std::sort(indices.begin() + static_cast<std::ptrdiff_t>(offset), indices.end());
+}
+
+void MeshKDTree::FindInRadius(const Base::Vector3f& p,
+                              float radius,
+                              std::vector<PointIndex>& indices) const
+{
+    d->Prepare();
+    std::size_t offset = indices.size();
+    d->tree.Range(p, radius, true, indices);
+    std::sort(indices.begin() + static_cast<std::ptrdiff_t>(offset), indices.end());
+}
+
+void MeshKDTree::FindNearest(const std::vector<Base::Vector3f>& points,
+                             int k,
+                             std::vector<PointIndex>& indices,
+                             std::vector<float>& distances) const
+{
+    d->Prepare();
+    auto num = static_cast<std::size_t>(std::max(k, 0));
+    indices.assign(points.size() * num, POINT_INDEX_MAX);
+    distances.assign(points.size() * num, FLT_MAX);
+    if (num == 0) {
+        return;
     }
+
+    parallel_for(points.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<Candidate> nearest;
+        nearest.reserve(num);
+        for (std::size_t i = first; i < last; i++) {
+            d->tree.KNearest(points[i], num, nearest);
+            for (std::size_t j = 0; j < nearest.size(); j++) {
+                indices[i * num + j] = d->tree.GetNode(nearest[j].node).i;
+                distances[i * num + j] = std::sqrt(nearest[j].dist2);
+            }
+        }
+    });
+}
+
+void MeshKDTree::FindInRadius(const std::vector<Base::Vector3f>& points,
+                              float radius,
+                              std::vector<std::vector<PointIndex>>& indices) const
+{
+    d->Prepare();
+    indices.clear();
+    indices.resize(points.size());
+    parallel_for(points.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            d->tree.Range(points[i], radius, true, indices[i]);
+            std::sort(indices[i].begin(), indices[i].end());
+        }
+    });
 }
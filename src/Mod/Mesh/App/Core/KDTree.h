@@ -29,6 +29,11 @@
 namespace MeshCore
 {
 
+/**
+ * A kd-tree over a set of points. The tree is stored in a flat array that is
+ * built by median splits, either at once when constructing it from a point
+ * array or lazily on the first query after points have been added.
+ */
 class MeshExport MeshKDTree
 {
 public:
@@ -49,7 +54,30 @@ public:
     PointIndex
     FindNearest(const Base::Vector3f& p, float max_dist, Base::Vector3f& n, float&) const;
     PointIndex FindExact(const Base::Vector3f& p) const;
+    /// Finds all points inside the box of half size \a range around \a p
     void FindInRange(const Base::Vector3f&, float, std::vector<PointIndex>&) const;
+    /// Finds all points whose distance to \a p is at most \a radius
+    void FindInRadius(const Base::Vector3f& p, float radius, std::vector<PointIndex>&) const;
+
+    /** @name Batch queries
+     * The query points are processed in parallel. Building the tree, if needed,
+     * is done before the threads start.
+     */
+    //@{
+    /**
+     * Finds the \a k nearest points of each of the query \a points, ordered by
+     * their distance. \a indices and \a distances get k entries per query point,
+     * if there are fewer points in the tree the rest is set to POINT_INDEX_MAX.
+     */
+    void FindNearest(const std::vector<Base::Vector3f>& points,
+                     int k,
+                     std::vector<PointIndex>& indices,
+                     std::vector<float>& distances) const;
+    /// Finds for each of the query \a points all points within the distance \a radius
+    void FindInRadius(const std::vector<Base::Vector3f>& points,
+                      float radius,
+                      std::vector<std::vector<PointIndex>>& indices) const;
+    //@}
 
     MeshKDTree(const MeshKDTree&) = delete;
     MeshKDTree(MeshKDTree&&) = delete;
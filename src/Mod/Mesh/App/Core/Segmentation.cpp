@@ -23,8 +23,12 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <unordered_set>
 #endif
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Segmentation.h"
@@ -42,6 +46,11 @@ bool MeshSurfaceSegment::TestInitialFacet(FacetIndex) const
 void MeshSurfaceSegment::AddFacet(const MeshFacet&)
 {}
 
+std::unique_ptr<MeshSurfaceSegment> MeshSurfaceSegment::Clone() const
+{
+    return {};
+}
+
 void MeshSurfaceSegment::AddSegment(const std::vector<FacetIndex>& segm)
 {
     if (segm.size() >= minFacets) {
@@ -107,6 +116,11 @@ void MeshDistancePlanarSegment::AddFacet(const MeshFacet& face)
     fitter->AddPoint(triangle.GetGravityPoint());
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshDistancePlanarSegment::Clone() const
+{
+    return std::make_unique<MeshDistancePlanarSegment>(kernel, GetMinFacets(), tolerance);
+}
+
 // --------------------------------------------------------
 
 PlaneSurfaceFit::PlaneSurfaceFit()
@@ -181,6 +195,14 @@ float PlaneSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
     }
 }
 
+std::unique_ptr<AbstractSurfaceFit> PlaneSurfaceFit::Clone() const
+{
+    if (fitter) {
+        return std::make_unique<PlaneSurfaceFit>();
+    }
+    return std::make_unique<PlaneSurfaceFit>(basepoint, normal);
+}
+
 std::vector<float> PlaneSurfaceFit::Parameters() const
 {
     Base::Vector3f base = basepoint;
@@ -286,6 +308,14 @@ float CylinderSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
     return (dist - radius);
 }
 
+std::unique_ptr<AbstractSurfaceFit> CylinderSurfaceFit::Clone() const
+{
+    if (fitter) {
+        return std::make_unique<CylinderSurfaceFit>();
+    }
+    return std::make_unique<CylinderSurfaceFit>(basepoint, axis, radius);
+}
+
 std::vector<float> CylinderSurfaceFit::Parameters() const
 {
     Base::Vector3f base = basepoint;
@@ -382,6 +412,14 @@ float SphereSurfaceFit::GetDistanceToSurface(const Base::Vector3f& pnt) const
     return (dist - radius);
 }
 
+std::unique_ptr<AbstractSurfaceFit> SphereSurfaceFit::Clone() const
+{
+    if (fitter) {
+        return std::make_unique<SphereSurfaceFit>();
+    }
+    return std::make_unique<SphereSurfaceFit>(center, radius);
+}
+
 std::vector<float> SphereSurfaceFit::Parameters() const
 {
     Base::Vector3f base = center;
@@ -452,6 +490,18 @@ void MeshDistanceGenericSurfaceFitSegment::AddFacet(const MeshFacet& face)
     fitter->AddTriangle(triangle);
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshDistanceGenericSurfaceFitSegment::Clone() const
+{
+    std::unique_ptr<AbstractSurfaceFit> fit = fitter->Clone();
+    if (!fit) {
+        return {};
+    }
+    return std::make_unique<MeshDistanceGenericSurfaceFitSegment>(fit.release(),
+                                                                  kernel,
+                                                                  GetMinFacets(),
+                                                                  tolerance);
+}
+
 std::vector<float> MeshDistanceGenericSurfaceFitSegment::Parameters() const
 {
     return fitter->Parameters();
@@ -474,6 +524,11 @@ bool MeshCurvaturePlanarSegment::TestFacet(const MeshFacet& rclFacet) const
     return true;
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshCurvaturePlanarSegment::Clone() const
+{
+    return std::make_unique<MeshCurvaturePlanarSegment>(GetCurvature(), GetMinFacets(), tolerance);
+}
+
 bool MeshCurvatureCylindricalSegment::TestFacet(const MeshFacet& rclFacet) const
 {
     for (PointIndex ptIndex : rclFacet._aulPoints) {
@@ -491,6 +546,15 @@ bool MeshCurvatureCylindricalSegment::TestFacet(const MeshFacet& rclFacet) const
     return true;
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshCurvatureCylindricalSegment::Clone() const
+{
+    return std::make_unique<MeshCurvatureCylindricalSegment>(GetCurvature(),
+                                                             GetMinFacets(),
+                                                             toleranceMin,
+                                                             toleranceMax,
+                                                             curvature);
+}
+
 bool MeshCurvatureSphericalSegment::TestFacet(const MeshFacet& rclFacet) const
 {
     for (PointIndex ptIndex : rclFacet._aulPoints) {
@@ -512,6 +576,14 @@ bool MeshCurvatureSphericalSegment::TestFacet(const MeshFacet& rclFacet) const
     return true;
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshCurvatureSphericalSegment::Clone() const
+{
+    return std::make_unique<MeshCurvatureSphericalSegment>(GetCurvature(),
+                                                           GetMinFacets(),
+                                                           tolerance,
+                                                           curvature);
+}
+
 bool MeshCurvatureFreeformSegment::TestFacet(const MeshFacet& rclFacet) const
 {
     for (PointIndex ptIndex : rclFacet._aulPoints) {
@@ -527,6 +599,16 @@ bool MeshCurvatureFreeformSegment::TestFacet(const MeshFacet& rclFacet) const
     return true;
 }
 
+std::unique_ptr<MeshSurfaceSegment> MeshCurvatureFreeformSegment::Clone() const
+{
+    return std::make_unique<MeshCurvatureFreeformSegment>(GetCurvature(),
+                                                          GetMinFacets(),
+                                                          toleranceMin,
+                                                          toleranceMax,
+                                                          c1,
+                                                          c2);
+}
+
 // --------------------------------------------------------
 
 MeshSurfaceVisitor::MeshSurfaceVisitor(MeshSurfaceSegment& segm, std::vector<FacetIndex>& indices)
@@ -555,8 +637,156 @@ bool MeshSurfaceVisitor::Visit(const MeshFacet& face,
 
 // --------------------------------------------------------
 
+namespace
+{
+struct SegmentRegion
+{
+    FacetIndex seed {FACET_INDEX_MAX};
+    std::vector<FacetIndex> indices;
+};
+
+// Does the same as MeshKernel::VisitNeighbourFacets() with a MeshSurfaceVisitor but instead of
+// setting the VISIT flag the visited facets are kept locally. Facets marked in 'claimed' are
+// treated as visited.
+void GrowRegion(const MeshKernel& kernel,
+                MeshSurfaceSegment& segm,
+                const std::vector<char>& claimed,
+                SegmentRegion& region)
+{
+    const MeshFacetArray& facets = kernel.GetFacets();
+    std::size_t numFacets = facets.size();
+
+    FacetIndex seed = region.seed;
+    segm.Initialize(seed);
+    if (segm.TestInitialFacet(seed)) {
+        region.indices.push_back(seed);
+    }
+
+    std::unordered_set<FacetIndex> visited;
+    visited.insert(seed);
+    std::vector<FacetIndex> currentLevel, nextLevel;
+    currentLevel.push_back(seed);
+    while (!currentLevel.empty()) {
+        for (FacetIndex index : currentLevel) {
+            for (FacetIndex nb : facets[index]._aulNeighbours) {
+                if (nb >= numFacets) {
+                    continue;  // no neighbour facet
+                }
+                const MeshFacet& face = facets[nb];
+                if (!segm.TestFacet(face)) {
+                    continue;
+                }
+                if (claimed[nb] || !visited.insert(nb).second) {
+                    continue;  // neighbour facet already visited
+                }
+                nextLevel.push_back(nb);
+                region.indices.push_back(nb);
+                segm.AddFacet(face);
+            }
+        }
+        currentLevel.swap(nextLevel);
+        nextLevel.clear();
+    }
+}
+}  // namespace
+
+void MeshSegmentAlgorithm::FindSegmentsParallel(std::vector<MeshSurfaceSegmentPtr>& segm)
+{
+    const MeshFacetArray& rFAry = myKernel.GetFacets();
+    std::size_t numFacets = rFAry.size();
+    std::size_t numThreads = static_cast<std::size_t>(std::max(QThread::idealThreadCount(), 1));
+    std::size_t maxSeeds = numThreads * 256;
+    std::size_t numSeeds = numThreads;
+
+    // replaces the VISIT flag of the serial search
+    std::vector<char> claimed(numFacets, 0);
+    std::vector<FacetIndex> resetVisited;
+    std::vector<SegmentRegion> regions;
+
+    for (auto& it : segm) {
+        for (FacetIndex index : resetVisited) {
+            claimed[index] = 0;
+        }
+        resetVisited.clear();
+
+        // The regions of the next not claimed facets are grown at once. A region is the same
+        // as with the serial search as long as it doesn't overlap with a region accepted
+        // before in the same round. Otherwise it's grown again with the current state.
+        std::size_t start = 0;
+        while (start < numFacets) {
+            regions.clear();
+            for (std::size_t index = start; index < numFacets && regions.size() < numSeeds;
+                 index++) {
+                if (!claimed[index]) {
+                    regions.emplace_back();
+                    regions.back().seed = index;
+                }
+            }
+            if (regions.empty()) {
+                break;
+            }
+
+            QtConcurrent::blockingMap(regions, [&](SegmentRegion& region) {
+                std::unique_ptr<MeshSurfaceSegment> clone = it->Clone();
+                GrowRegion(myKernel, *clone, claimed, region);
+            });
+
+            start = regions.back().seed + 1;
+            std::size_t wasted = 0;
+            for (auto& region : regions) {
+                if (claimed[region.seed]) {
+                    wasted++;
+                    continue;  // added to a region of a preceding start facet
+                }
+                bool overlaps =
+                    std::any_of(region.indices.begin(), region.indices.end(), [&](FacetIndex i) {
+                        return claimed[i] != 0;
+                    });
+                if (overlaps) {
+                    wasted++;
+                    region.indices.clear();
+                    std::unique_ptr<MeshSurfaceSegment> clone = it->Clone();
+                    GrowRegion(myKernel, *clone, claimed, region);
+                }
+
+                claimed[region.seed] = 1;
+                for (FacetIndex index : region.indices) {
+                    claimed[index] = 1;
+                }
+
+                // add or discard the segment
+                if (region.indices.size() <= 1) {
+                    resetVisited.push_back(region.seed);
+                }
+                else {
+                    it->AddSegment(region.indices);
+                }
+            }
+
+            // Many small regions need large rounds to keep the threads busy, while for large
+            // regions most start facets of a round end up in the same region
+            if (wasted * 4 <= regions.size()) {
+                numSeeds = std::min(numSeeds * 2, maxSeeds);
+            }
+            else {
+                numSeeds = std::max(numSeeds / 2, numThreads);
+            }
+        }
+    }
+}
+
 void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm)
 {
+    if (parallel) {
+        bool canClone = std::all_of(segm.begin(), segm.end(), [](const MeshSurfaceSegmentPtr& it) {
+            return it->Clone() != nullptr;
+        });
+        if (canClone) {
+            FindSegmentsParallel(segm);
+            return;
+        }
+    }
+
     // reset VISIT flags
     FacetIndex startFacet {};
     MeshCore::MeshAlgorithm cAlgo(myKernel);
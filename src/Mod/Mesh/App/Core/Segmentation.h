@@ -58,6 +58,10 @@ public:
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
     virtual void AddFacet(const MeshFacet& rclFacet);
+    /** Returns a new instance with the same settings but without any segments. It's used
+     * to grow several regions at once. If null is returned the segments are searched serially.
+     */
+    virtual std::unique_ptr<MeshSurfaceSegment> Clone() const;
     void AddSegment(const std::vector<FacetIndex>&);
     const std::vector<MeshSegment>& GetSegments() const
     {
@@ -65,6 +69,12 @@ public:
     }
     MeshSegment FindSegment(FacetIndex) const;
 
+protected:
+    unsigned long GetMinFacets() const
+    {
+        return minFacets;
+    }
+
 private:
     std::vector<MeshSegment> segments;
     unsigned long minFacets;
@@ -107,6 +117,7 @@ public:
     }
     void Initialize(FacetIndex) override;
     void AddFacet(const MeshFacet& rclFacet) override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
 
 private:
     Base::Vector3f basepoint;
@@ -133,6 +144,11 @@ public:
     virtual float Fit() = 0;
     virtual float GetDistanceToSurface(const Base::Vector3f&) const = 0;
     virtual std::vector<float> Parameters() const = 0;
+    /// Returns a new instance with the same settings, or null if not supported
+    virtual std::unique_ptr<AbstractSurfaceFit> Clone() const
+    {
+        return {};
+    }
 };
 
 class MeshExport PlaneSurfaceFit: public AbstractSurfaceFit
@@ -158,6 +174,7 @@ public:
     float Fit() override;
     float GetDistanceToSurface(const Base::Vector3f&) const override;
     std::vector<float> Parameters() const override;
+    std::unique_ptr<AbstractSurfaceFit> Clone() const override;
 
 private:
     Base::Vector3f basepoint;
@@ -188,6 +205,7 @@ public:
     float Fit() override;
     float GetDistanceToSurface(const Base::Vector3f&) const override;
     std::vector<float> Parameters() const override;
+    std::unique_ptr<AbstractSurfaceFit> Clone() const override;
 
 private:
     Base::Vector3f basepoint;
@@ -219,6 +237,7 @@ public:
     float Fit() override;
     float GetDistanceToSurface(const Base::Vector3f&) const override;
     std::vector<float> Parameters() const override;
+    std::unique_ptr<AbstractSurfaceFit> Clone() const override;
 
 private:
     Base::Vector3f center;
@@ -250,6 +269,7 @@ public:
     void Initialize(FacetIndex) override;
     bool TestInitialFacet(FacetIndex) const override;
     void AddFacet(const MeshFacet& rclFacet) override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
     std::vector<float> Parameters() const;
 
 private:
@@ -271,6 +291,12 @@ public:
         return info.at(pos);
     }
 
+protected:
+    const std::vector<CurvatureInfo>& GetCurvature() const
+    {
+        return info;
+    }
+
 private:
     const std::vector<CurvatureInfo>& info;
 };
@@ -285,6 +311,7 @@ public:
         , tolerance(tol)
     {}
     bool TestFacet(const MeshFacet& rclFacet) const override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
     const char* GetType() const override
     {
         return "Plane";
@@ -308,6 +335,7 @@ public:
         , toleranceMax(tolMax)
     {}
     bool TestFacet(const MeshFacet& rclFacet) const override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
     const char* GetType() const override
     {
         return "Cylinder";
@@ -331,6 +359,7 @@ public:
         , tolerance(tol)
     {}
     bool TestFacet(const MeshFacet& rclFacet) const override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
     const char* GetType() const override
     {
         return "Sphere";
@@ -357,6 +386,7 @@ public:
         , toleranceMax(tolMax)
     {}
     bool TestFacet(const MeshFacet& rclFacet) const override;
+    std::unique_ptr<MeshSurfaceSegment> Clone() const override;
     const char* GetType() const override
     {
         return "Freeform";
@@ -390,10 +420,25 @@ public:
     explicit MeshSegmentAlgorithm(const MeshKernel& kernel)
         : myKernel(kernel)
     {}
+    /**
+     * Enables the parallel mode. The regions of several start facets are grown at once
+     * and a region that overlaps with a region of a preceding start facet is grown again.
+     * The segments are the same as with the serial search, except that each region starts
+     * with a fresh copy of the surface fit while the serial search continues with the fit of
+     * the previous region. If a segment doesn't support Clone() the serial search is used.
+     */
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
     void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
 
+private:
+    void FindSegmentsParallel(std::vector<MeshSurfaceSegmentPtr>&);
+
 private:
     const MeshKernel& myKernel;
+    bool parallel {false};
 };
 
 }  // namespace MeshCore
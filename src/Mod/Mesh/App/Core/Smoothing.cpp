@@ -21,18 +21,78 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <numeric>
+#endif
 
 #include <Base/Tools.h>
 
-#include "Algorithm.h"
 #include "Approximation.h"
-#include "Iterator.h"
+#include "Functional.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
 
 
 using namespace MeshCore;
 
+namespace
+{
+// Sorts the values of each list and removes duplicates
+template<typename T>
+void SortAndCompact(std::vector<std::size_t>& offsets, std::vector<T>& values)
+{
+    std::size_t dst = 0;
+    for (std::size_t i = 0; i + 1 < offsets.size(); i++) {
+        auto first = values.begin() + static_cast<std::ptrdiff_t>(offsets[i]);
+        auto last = values.begin() + static_cast<std::ptrdiff_t>(offsets[i + 1]);
+        std::sort(first, last);
+        last = std::unique(first, last);
+        offsets[i] = dst;
+        for (auto it = first; it != last; ++it) {
+            values[dst++] = *it;
+        }
+    }
+    offsets.back() = dst;
+    values.resize(dst);
+}
+}  // namespace
+
+PointNeighbourhood::PointNeighbourhood(const MeshKernel& kernel)
+{
+    const MeshFacetArray& rFacets = kernel.GetFacets();
+    std::size_t numPoints = kernel.CountPoints();
+
+    pointOffsets.assign(numPoints + 1, 0);
+    facetOffsets.assign(numPoints + 1, 0);
+    for (const auto& face : rFacets) {
+        for (PointIndex pos : face._aulPoints) {
+            pointOffsets[pos + 1] += 2;
+            facetOffsets[pos + 1] += 1;
+        }
+    }
+    std::partial_sum(pointOffsets.begin(), pointOffsets.end(), pointOffsets.begin());
+    std::partial_sum(facetOffsets.begin(), facetOffsets.end(), facetOffsets.begin());
+
+    points.resize(pointOffsets.back());
+    facets.resize(facetOffsets.back());
+    std::vector<std::size_t> pointFill(pointOffsets.begin(), pointOffsets.end() - 1);
+    std::vector<std::size_t> facetFill(facetOffsets.begin(), facetOffsets.end() - 1);
+    for (FacetIndex index = 0; index < rFacets.size(); index++) {
+        const MeshFacet& face = rFacets[index];
+        for (int i = 0; i < 3; i++) {
+            PointIndex pos = face._aulPoints[i];
+            points[pointFill[pos]++] = face._aulPoints[(i + 1) % 3];
+            points[pointFill[pos]++] = face._aulPoints[(i + 2) % 3];
+            facets[facetFill[pos]++] = index;
+        }
+    }
+
+    SortAndCompact(pointOffsets, points);
+    SortAndCompact(facetOffsets, facets);
+}
+
+// ----------------------------------------------------------------------------
 
 AbstractSmoothing::AbstractSmoothing(MeshKernel& m)
     : kernel(m)
@@ -46,56 +106,78 @@ void AbstractSmoothing::initialize(Component comp, Continuity cont)
     this->continuity = cont;
 }
 
-PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
-    : AbstractSmoothing(m)
-{}
+void AbstractSmoothing::ParallelFor(std::size_t count,
+                                    const std::function<void(std::size_t, std::size_t)>& func) const
+{
+    // Smaller blocks are not worth to start a thread
+    constexpr std::size_t minBlockSize = 4096;
+    parallel_for(count, func, threads, minBlockSize);
+}
 
-void PlaneFitSmoothing::Smooth(unsigned int iterations)
+// ----------------------------------------------------------------------------
+
+namespace
+{
+Base::Vector3f PlaneFitPoint(const MeshPointArray& points,
+                             const PointNeighbourhood& neighbourhood,
+                             PointIndex pos,
+                             float maximum)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
+    const Base::Vector3f& pnt = points[pos];
+    auto cv = neighbourhood.GetPoints(pos);
+    if (cv.size() < 3) {
+        return pnt;
+    }
 
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    MeshCore::PlaneFit pf;
+    pf.AddPoint(pnt);
+    Base::Vector3f center = pnt;
+    for (PointIndex index : cv) {
+        pf.AddPoint(points[index]);
+        center += points[index];
+    }
 
-    for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (v_it.Begin(); v_it.More(); v_it.Next()) {
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
-            }
+    float scale = 1.0f / (static_cast<float>(cv.size()) + 1.0f);
+    center.Scale(scale, scale, scale);
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
+    // get the mean plane of the current vertex with the surrounding vertices
+    pf.Fit();
+    Base::Vector3f N = pf.GetNormal();
+    N.Normalize();
 
-            float scale = 1.0f / (static_cast<float>(cv.size()) + 1.0f);
-            center.Scale(scale, scale, scale);
+    // look in which direction we should move the vertex
+    Base::Vector3f L = pnt - center;
+    if (N * L < 0.0f) {
+        N.Scale(-1.0, -1.0, -1.0);
+    }
 
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+    // maximum value to move is distance to mean plane
+    float d = std::min<float>(fabs(maximum), fabs(N * L));
+    N.Scale(d, d, d);
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0f) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+    return pnt - N;
+}
+}  // namespace
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+PlaneFitSmoothing::PlaneFitSmoothing(MeshKernel& m)
+    : AbstractSmoothing(m)
+{}
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+void PlaneFitSmoothing::Smooth(unsigned int iterations)
+{
+    PointNeighbourhood neighbourhood(kernel);
+    const MeshPointArray& points = kernel.GetPoints();
+    std::vector<Base::Vector3f> PointArray(points.size());
+
+    for (unsigned int i = 0; i < iterations; i++) {
+        ParallelFor(points.size(), [&](std::size_t first, std::size_t last) {
+            for (std::size_t pos = first; pos < last; pos++) {
+                PointArray[pos] = PlaneFitPoint(points,
+                                                neighbourhood,
+                                                static_cast<PointIndex>(pos),
+                                                this->maximum);
+            }
+        });
 
         // assign values without affecting iterators
         PointIndex count = kernel.CountPoints();
@@ -108,156 +190,116 @@ void PlaneFitSmoothing::Smooth(unsigned int iterations)
 void PlaneFitSmoothing::SmoothPoints(unsigned int iterations,
                                      const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshPoint center;
-    MeshCore::MeshPointArray PointArray = kernel.GetPoints();
-
-    MeshCore::MeshPointIterator v_it(kernel);
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshPointArray::_TConstIterator v_beg = kernel.GetPoints().begin();
+    PointNeighbourhood neighbourhood(kernel);
+    const MeshPointArray& points = kernel.GetPoints();
+    std::vector<Base::Vector3f> PointArray(point_indices.size());
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Base::Vector3f N, L;
-        for (PointIndex it : point_indices) {
-            v_it.Set(it);
-            MeshCore::PlaneFit pf;
-            pf.AddPoint(*v_it);
-            center = *v_it;
-            const std::set<PointIndex>& cv = vv_it[v_it.Position()];
-            if (cv.size() < 3) {
-                continue;
+        ParallelFor(point_indices.size(), [&](std::size_t first, std::size_t last) {
+            for (std::size_t j = first; j < last; j++) {
+                PointArray[j] =
+                    PlaneFitPoint(points, neighbourhood, point_indices[j], this->maximum);
             }
+        });
 
-            std::set<PointIndex>::const_iterator cv_it;
-            for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-                pf.AddPoint(v_beg[*cv_it]);
-                center += v_beg[*cv_it];
-            }
-
-            float scale = 1.0f / (static_cast<float>(cv.size()) + 1.0f);
-            center.Scale(scale, scale, scale);
-
-            // get the mean plane of the current vertex with the surrounding vertices
-            pf.Fit();
-            N = pf.GetNormal();
-            N.Normalize();
+        // assign values without affecting iterators
+        for (std::size_t j = 0; j < point_indices.size(); j++) {
+            kernel.SetPoint(point_indices[j], PointArray[j]);
+        }
+    }
+}
 
-            // look in which direction we should move the vertex
-            L.Set(v_it->x - center.x, v_it->y - center.y, v_it->z - center.z);
-            if (N * L < 0.0f) {
-                N.Scale(-1.0, -1.0, -1.0);
-            }
+// ----------------------------------------------------------------------------
 
-            // maximum value to move is distance to mean plane
-            float d = std::min<float>(fabs(this->maximum), fabs(N * L));
-            N.Scale(d, d, d);
+namespace
+{
+Base::Vector3f UmbrellaPoint(const MeshPointArray& points,
+                             const PointNeighbourhood& neighbourhood,
+                             PointIndex pos,
+                             double stepsize)
+{
+    const Base::Vector3f& pnt = points[pos];
+    auto cv = neighbourhood.GetPoints(pos);
+    if (cv.size() < 3) {
+        return pnt;
+    }
+    if (cv.size() != neighbourhood.GetFacets(pos).size()) {
+        // do nothing for border points
+        return pnt;
+    }
 
-            PointArray[v_it.Position()].Set(v_it->x - N.x, v_it->y - N.y, v_it->z - N.z);
-        }
+    double w = 1.0 / double(cv.size());
 
-        // assign values without affecting iterators
-        PointIndex count = kernel.CountPoints();
-        for (PointIndex idx = 0; idx < count; idx++) {
-            kernel.SetPoint(idx, PointArray[idx]);
-        }
+    double delx = 0.0, dely = 0.0, delz = 0.0;
+    for (PointIndex index : cv) {
+        delx += w * static_cast<double>(points[index].x - pnt.x);
+        dely += w * static_cast<double>(points[index].y - pnt.y);
+        delz += w * static_cast<double>(points[index].z - pnt.z);
     }
+
+    float x = static_cast<float>(static_cast<double>(pnt.x) + stepsize * delx);
+    float y = static_cast<float>(static_cast<double>(pnt.y) + stepsize * dely);
+    float z = static_cast<float>(static_cast<double>(pnt.z) + stepsize * delz);
+    return Base::Vector3f(x, y, z);
 }
+}  // namespace
 
 LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
-                                double stepsize)
+void LaplaceSmoothing::Umbrella(const PointNeighbourhood& neighbourhood, double stepsize)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
+    std::vector<Base::Vector3f> PointArray(points.size());
 
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
+    ParallelFor(points.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t pos = first; pos < last; pos++) {
+            PointArray[pos] =
+                UmbrellaPoint(points, neighbourhood, static_cast<PointIndex>(pos), stepsize);
         }
+    });
 
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
-
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
+    PointIndex count = kernel.CountPoints();
+    for (PointIndex idx = 0; idx < count; idx++) {
+        kernel.SetPoint(idx, PointArray[idx]);
     }
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
+void LaplaceSmoothing::Umbrella(const PointNeighbourhood& neighbourhood,
                                 double stepsize,
                                 const std::vector<PointIndex>& point_indices)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
+    std::vector<Base::Vector3f> PointArray(point_indices.size());
 
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
+    ParallelFor(point_indices.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t j = first; j < last; j++) {
+            PointArray[j] = UmbrellaPoint(points, neighbourhood, point_indices[j], stepsize);
         }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+    });
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
-        }
-
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
+    for (std::size_t j = 0; j < point_indices.size(); j++) {
+        kernel.SetPoint(point_indices[j], PointArray[j]);
     }
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    PointNeighbourhood neighbourhood(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(neighbourhood, lambda);
     }
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
                                     const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    PointNeighbourhood neighbourhood(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(neighbourhood, lambda, point_indices);
     }
 }
 
@@ -267,31 +309,31 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    PointNeighbourhood neighbourhood(kernel);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
+        Umbrella(neighbourhood, GetLambda());
+        Umbrella(neighbourhood, -(GetLambda() + micro));
     }
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations,
                                    const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    PointNeighbourhood neighbourhood(kernel);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        Umbrella(neighbourhood, GetLambda(), point_indices);
+        Umbrella(neighbourhood, -(GetLambda() + micro), point_indices);
     }
 }
 
+// ----------------------------------------------------------------------------
+
 namespace
 {
 using AngleNormal = std::pair<double, Base::Vector3d>;
@@ -326,94 +368,112 @@ MedianFilterSmoothing::MedianFilterSmoothing(MeshKernel& m)
 
 void MedianFilterSmoothing::Smooth(unsigned int iterations)
 {
-    std::vector<unsigned long> point_indices(kernel.CountPoints());
-    std::generate(point_indices.begin(), point_indices.end(), Base::iotaGen<unsigned long>(0));
-    MeshCore::MeshRefFacetToFacets ff_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    std::vector<PointIndex> point_indices(kernel.CountPoints());
+    std::generate(point_indices.begin(), point_indices.end(), Base::iotaGen<PointIndex>(0));
+    PointNeighbourhood neighbourhood(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
+        UpdatePoints(neighbourhood, point_indices);
     }
 }
 
 void MedianFilterSmoothing::SmoothPoints(unsigned int iterations,
                                          const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefFacetToFacets ff_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    PointNeighbourhood neighbourhood(kernel);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
+        UpdatePoints(neighbourhood, point_indices);
     }
 }
 
-void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
-                                         const MeshRefPointToFacets& vf_it,
+void MedianFilterSmoothing::UpdatePoints(const PointNeighbourhood& neighbourhood,
                                          const std::vector<PointIndex>& point_indices)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
     const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
 
-    // Initialize the array with the real normals
-    std::vector<Base::Vector3d> faceNormals;
-    faceNormals.reserve(facets.size());
-    MeshCore::MeshFacetIterator iter(kernel);
-    for (iter.Init(); iter.More(); iter.Next()) {
-        faceNormals.emplace_back(Base::toVector<double>(iter->GetNormal()));
-    }
+    // Initialize the arrays with the real normals, areas and centers of gravity
+    std::vector<Base::Vector3d> realNormals(facets.size());
+    std::vector<Base::Vector3d> centers(facets.size());
+    std::vector<double> areas(facets.size());
+    ParallelFor(facets.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t pos = first; pos < last; pos++) {
+            MeshGeomFacet face = kernel.GetFacet(facets[pos]);
+            realNormals[pos] = Base::toVector<double>(face.GetNormal());
+            centers[pos] = Base::toVector<double>(face.GetGravityPoint());
+            areas[pos] = face.Area();
+        }
+    });
 
     // Step 1: determine face normals
-    for (FacetIndex pos = 0; pos < facets.size(); pos++) {
-        iter.Set(pos);
-        Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
-        const MeshCore::MeshFacet& facet = facets[pos];
-
+    std::vector<Base::Vector3d> faceNormals(facets.size());
+    ParallelFor(facets.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<FacetIndex> cv;
         std::vector<AngleNormal> anglesWithFaces;
-        for (auto fi : cv) {
-            iter.Set(fi);
-            Base::Vector3d faceNormal = Base::toVector<double>(iter->GetNormal());
-            double angle = refNormal.GetAngle(faceNormal);
-
-            int absWeight = std::abs(weights);
-            if (absWeight > 1 && facet.IsNeighbour(fi)) {
-                if (weights < 0) {
-                    angle = -angle;
+        for (std::size_t pos = first; pos < last; pos++) {
+            const MeshCore::MeshFacet& facet = facets[pos];
+            const Base::Vector3d& refNormal = realNormals[pos];
+
+            // all facets sharing a point with this facet
+            cv.clear();
+            for (PointIndex pnt : facet._aulPoints) {
+                auto adjacent = neighbourhood.GetFacets(pnt);
+                cv.insert(cv.end(), adjacent.begin(), adjacent.end());
+            }
+            std::sort(cv.begin(), cv.end());
+            cv.erase(std::unique(cv.begin(), cv.end()), cv.end());
+
+            anglesWithFaces.clear();
+            for (auto fi : cv) {
+                const Base::Vector3d& faceNormal = realNormals[fi];
+                double angle = refNormal.GetAngle(faceNormal);
+
+                int absWeight = std::abs(weights);
+                if (absWeight > 1 && facet.IsNeighbour(fi)) {
+                    if (weights < 0) {
+                        angle = -angle;
+                    }
+                    for (int i = 0; i < absWeight; i++) {
+                        anglesWithFaces.emplace_back(angle, faceNormal);
+                    }
                 }
-                for (int i = 0; i < absWeight; i++) {
+                else {
                     anglesWithFaces.emplace_back(angle, faceNormal);
                 }
             }
-            else {
-                anglesWithFaces.emplace_back(angle, faceNormal);
-            }
-        }
 
-        faceNormals[pos] = find_median(anglesWithFaces);
-    }
+            faceNormals[pos] = find_median(anglesWithFaces);
+        }
+    });
 
     // Step 2: move vertices
-    for (auto pos : point_indices) {
-        Base::Vector3d P = Base::toVector<double>(points[pos]);
-        const std::set<FacetIndex>& cv = vf_it[pos];
-
-        double totalArea = 0.0;
-        Base::Vector3d totalvT;
-        for (auto it : cv) {
-            iter.Set(it);
-
-            double faceArea = iter->Area();
-            totalArea += faceArea;
-
-            Base::Vector3d C = Base::toVector<double>(iter->GetGravityPoint());
+    std::vector<Base::Vector3f> PointArray(point_indices.size());
+    ParallelFor(point_indices.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t j = first; j < last; j++) {
+            PointIndex pos = point_indices[j];
+            Base::Vector3d P = Base::toVector<double>(points[pos]);
+
+            double totalArea = 0.0;
+            Base::Vector3d totalvT;
+            for (auto it : neighbourhood.GetFacets(pos)) {
+                double faceArea = areas[it];
+                totalArea += faceArea;
+
+                Base::Vector3d PC = centers[it] - P;
+                const Base::Vector3d& mT = faceNormals[it];
+                Base::Vector3d vT = (PC * mT) * mT;
+                totalvT += vT * faceArea;
+            }
 
-            Base::Vector3d PC = C - P;
-            Base::Vector3d mT = faceNormals[it];
-            Base::Vector3d vT = (PC * mT) * mT;
-            totalvT += vT * faceArea;
+            if (totalArea > 0.0) {
+                P = P + totalvT / totalArea;
+            }
+            PointArray[j] = Base::toVector<float>(P);
         }
+    });
 
-        P = P + totalvT / totalArea;
-        kernel.SetPoint(pos, Base::toVector<float>(P));
+    for (std::size_t j = 0; j < point_indices.size(); j++) {
+        kernel.SetPoint(point_indices[j], PointArray[j]);
     }
 }
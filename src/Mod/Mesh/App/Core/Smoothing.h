@@ -24,6 +24,7 @@
 #define MESH_SMOOTHING_H
 
 #include <cfloat>
+#include <functional>
 #include <vector>
 
 #include "Definitions.h"
@@ -32,9 +33,61 @@
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
-class MeshRefPointToFacets;
-class MeshRefFacetToFacets;
+
+/**
+ * Flat lists of the neighbour points and the adjacent facets of each point.
+ * Unlike MeshRefPointToPoints and MeshRefPointToFacets it is cheap to iterate,
+ * so it is built once and shared by all iterations and threads of a smoothing
+ * algorithm.
+ */
+class MeshExport PointNeighbourhood
+{
+public:
+    template<typename T>
+    class Range
+    {
+    public:
+        Range(const T* first, const T* last)
+            : first(first)
+            , last(last)
+        {}
+        const T* begin() const
+        {
+            return first;
+        }
+        const T* end() const
+        {
+            return last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+
+    private:
+        const T* first;
+        const T* last;
+    };
+
+    explicit PointNeighbourhood(const MeshKernel&);
+
+    /// Returns the sorted indices of the points connected to the point \a pos
+    Range<PointIndex> GetPoints(PointIndex pos) const
+    {
+        return {points.data() + pointOffsets[pos], points.data() + pointOffsets[pos + 1]};
+    }
+    /// Returns the sorted indices of the facets that reference the point \a pos
+    Range<FacetIndex> GetFacets(PointIndex pos) const
+    {
+        return {facets.data() + facetOffsets[pos], facets.data() + facetOffsets[pos + 1]};
+    }
+
+private:
+    std::vector<std::size_t> pointOffsets;
+    std::vector<PointIndex> points;
+    std::vector<std::size_t> facetOffsets;
+    std::vector<FacetIndex> facets;
+};
 
 /** Base class for smoothing algorithms. */
 class MeshExport AbstractSmoothing
@@ -62,17 +115,30 @@ public:
     AbstractSmoothing& operator=(AbstractSmoothing&&) = delete;
 
     void initialize(Component comp, Continuity cont);
+    /**
+     * Sets the number of threads, 0 uses all available cores. All points of an
+     * iteration are moved at once, so the result doesn't depend on this number.
+     */
+    void SetThreadCount(int count)
+    {
+        threads = count;
+    }
 
     /** Smooth the triangle mesh. */
     virtual void Smooth(unsigned int) = 0;
     virtual void SmoothPoints(unsigned int, const std::vector<PointIndex>&) = 0;
 
 protected:
+    /// Calls \a func for consecutive sub-ranges of [0, count) in separate threads
+    void ParallelFor(std::size_t count,
+                     const std::function<void(std::size_t, std::size_t)>& func) const;
+
     // NOLINTBEGIN
     MeshKernel& kernel;
 
     Component component {Normal};
     Continuity continuity {C0};
+    int threads {0};
     // NOLINTEND
 };
 
@@ -107,11 +173,8 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
-                  double,
-                  const std::vector<PointIndex>&);
+    void Umbrella(const PointNeighbourhood&, double);
+    void Umbrella(const PointNeighbourhood&, double, const std::vector<PointIndex>&);
 
 private:
     double lambda {0.6307};
@@ -149,9 +212,7 @@ public:
     void SmoothPoints(unsigned int, const std::vector<PointIndex>&) override;
 
 private:
-    void UpdatePoints(const MeshRefFacetToFacets&,
-                      const MeshRefPointToFacets&,
-                      const std::vector<PointIndex>&);
+    void UpdatePoints(const PointNeighbourhood&, const std::vector<PointIndex>&);
 
 private:
     int weights {1};
@@ -58,10 +58,8 @@ App::DocumentObjectExecReturn* Curvature::execute()
     }
 
     // get all points
-    const MeshCore::MeshKernel& rMesh = pcFeat->Mesh.getValue().getKernel();
-    MeshCore::MeshCurvature meshCurv(rMesh);
-    meshCurv.ComputePerVertex();
-    const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
+    auto curvature = pcFeat->Mesh.getValue().getCurvaturePerVertex();
+    const std::vector<MeshCore::CurvatureInfo>& curv = *curvature;
 
     std::vector<CurvatureInfo> values;
     values.reserve(curv.size());
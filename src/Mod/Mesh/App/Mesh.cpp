@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #endif
 
@@ -39,6 +40,7 @@
 #include <Base/Writer.h>
 
 #include "Core/Builder.h"
+#include "Core/Curvature.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
 #include "Core/Grid.h"
@@ -156,6 +158,7 @@ void MeshObject::getFacesFromSubElement(const Data::Segment* element,
 
 void MeshObject::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    invalidateCurvature();
     MeshCore::MeshKernel kernel;
     swap(kernel);
     kernel.Transform(rclMat);
@@ -217,6 +220,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 
 MeshObject& MeshObject::operator=(const MeshObject& mesh)
 {
+    invalidateCurvature();
     if (this != &mesh) {
         // copy the mesh structure
         setTransform(mesh._Mtrx);
@@ -229,6 +233,7 @@ MeshObject& MeshObject::operator=(const MeshObject& mesh)
 
 MeshObject& MeshObject::operator=(MeshObject&& mesh)
 {
+    invalidateCurvature();
     if (this != &mesh) {
         // copy the mesh structure
         setTransform(mesh._Mtrx);
@@ -241,12 +246,14 @@ MeshObject& MeshObject::operator=(MeshObject&& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
+    invalidateCurvature();
     this->_kernel = m;
     this->_segments.clear();
 }
 
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
+    invalidateCurvature();
     this->_kernel.Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
@@ -255,6 +262,8 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
+    invalidateCurvature();
+    mesh.invalidateCurvature();
     this->_kernel.Swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp = this->_Mtrx;
@@ -389,6 +398,7 @@ void MeshObject::Restore(Base::XMLReader& /*reader*/)
 
 void MeshObject::RestoreDocFile(Base::Reader& reader)
 {
+    invalidateCurvature();
     load(reader);
 }
 
@@ -452,6 +462,7 @@ void MeshObject::save(std::ostream& str,
 
 bool MeshObject::load(const char* file, MeshCore::Material* mat)
 {
+    invalidateCurvature();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadAny(file)) {
@@ -464,6 +475,7 @@ bool MeshObject::load(const char* file, MeshCore::Material* mat)
 
 bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::Material* mat)
 {
+    invalidateCurvature();
     MeshCore::MeshKernel kernel;
     MeshCore::MeshInput aReader(kernel, mat);
     if (!aReader.LoadFormat(str, f)) {
@@ -476,6 +488,7 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g)
 {
+    invalidateCurvature();
     _kernel.Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
@@ -519,6 +532,7 @@ void MeshObject::save(std::ostream& out) const
 
 void MeshObject::load(std::istream& in)
 {
+    invalidateCurvature();
     _kernel.Read(in);
     this->_segments.clear();
 
@@ -573,16 +587,19 @@ void MeshObject::writeInventor(std::ostream& str, float creaseangle) const
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
+    invalidateCurvature();
     _kernel.AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateCurvature();
     _kernel.AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets, bool checkManifolds)
 {
+    invalidateCurvature();
     _kernel.AddFacets(facets, checkManifolds);
 }
 
@@ -590,6 +607,7 @@ void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet>& facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
+    invalidateCurvature();
     _kernel.AddFacets(facets, points, checkManifolds);
 }
 
@@ -597,6 +615,7 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
                            const std::vector<Base::Vector3d>& points,
                            bool checkManifolds)
 {
+    invalidateCurvature();
     std::vector<MeshCore::MeshFacet> facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -619,12 +638,14 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
+    invalidateCurvature();
     _kernel = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facets,
                            const std::vector<Base::Vector3d>& points)
 {
+    invalidateCurvature();
     MeshCore::MeshFacetArray facet_v;
     facet_v.reserve(facets.size());
     for (auto facet : facets) {
@@ -647,16 +668,19 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet>& facet
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
+    invalidateCurvature();
     _kernel.Merge(mesh._kernel);
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
+    invalidateCurvature();
     _kernel.Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 {
+    invalidateCurvature();
     if (removeIndices.empty()) {
         return;
     }
@@ -666,6 +690,7 @@ void MeshObject::deleteFacets(const std::vector<FacetIndex>& removeIndices)
 
 void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
 {
+    invalidateCurvature();
     if (removeIndices.empty()) {
         return;
     }
@@ -675,6 +700,7 @@ void MeshObject::deletePoints(const std::vector<PointIndex>& removeIndices)
 
 void MeshObject::deletedFacets(const std::vector<FacetIndex>& remFacets)
 {
+    invalidateCurvature();
     if (remFacets.empty()) {
         return;  // nothing has changed
     }
@@ -893,6 +919,7 @@ unsigned long MeshObject::countComponents() const
 
 void MeshObject::removeComponents(unsigned long count)
 {
+    invalidateCurvature();
     std::vector<FacetIndex> removeIndices;
     MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
     _kernel.DeleteFacets(removeIndices);
@@ -930,6 +957,7 @@ void MeshObject::fillupHoles(unsigned long length,
                              int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
+    invalidateCurvature();
     std::list<std::vector<PointIndex>> aFailed;
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.FillupHoles(length, level, cTria, aFailed);
@@ -937,6 +965,7 @@ void MeshObject::fillupHoles(unsigned long length,
 
 void MeshObject::offset(float fSize)
 {
+    invalidateCurvature();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -951,6 +980,7 @@ void MeshObject::offset(float fSize)
 
 void MeshObject::offsetSpecial2(float fSize)
 {
+    invalidateCurvature();
     Base::Builder3D builder;
     std::vector<Base::Vector3f> PointNormals = _kernel.CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
@@ -1018,6 +1048,7 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
+    invalidateCurvature();
     std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
 
     unsigned int i = 0;
@@ -1038,6 +1069,7 @@ void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 
 void MeshObject::clear()
 {
+    invalidateCurvature();
     _kernel.Clear();
     this->_segments.clear();
     setTransform(Base::Matrix4D());
@@ -1045,6 +1077,7 @@ void MeshObject::clear()
 
 void MeshObject::transformToEigenSystem()
 {
+    invalidateCurvature();
     MeshCore::MeshEigensystem cMeshEval(_kernel);
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
@@ -1061,6 +1094,7 @@ Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 
 void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 {
+    invalidateCurvature();
     // v is a vector, hence we must not apply the translation part
     // of the transformation to the vector
     Base::Vector3d vec(v);
@@ -1072,23 +1106,29 @@ void MeshObject::movePoint(PointIndex index, const Base::Vector3d& v)
 
 void MeshObject::setPoint(PointIndex index, const Base::Vector3d& p)
 {
+    invalidateCurvature();
     _kernel.SetPoint(index, transformPointToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
+    invalidateCurvature();
     _kernel.Smooth(iterations, d_max);
 }
 
-void MeshObject::decimate(float fTolerance, float fReduction)
+void MeshObject::decimate(float fTolerance, float fReduction, bool parallel)
 {
+    invalidateCurvature();
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setParallel(parallel);
     dm.simplify(fTolerance, fReduction);
 }
 
-void MeshObject::decimate(int targetSize)
+void MeshObject::decimate(int targetSize, bool parallel)
 {
+    invalidateCurvature();
     MeshCore::MeshSimplify dm(this->_kernel);
+    dm.setParallel(parallel);
     dm.simplify(targetSize);
 }
 
@@ -1132,6 +1172,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj,
                      MeshObject::CutType type)
 {
+    invalidateCurvature();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1162,6 +1203,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj,
                       MeshObject::CutType type)
 {
+    invalidateCurvature();
     MeshCore::MeshKernel kernel(this->_kernel);
     kernel.Transform(getTransform());
 
@@ -1198,6 +1240,7 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
 
 void MeshObject::trimByPlane(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
+    invalidateCurvature();
     MeshCore::MeshTrimByPlane trim(this->_kernel);
     std::vector<FacetIndex> trimFacets, removeFacets;
     std::vector<MeshCore::MeshGeomFacet> triangle;
@@ -1342,6 +1385,7 @@ MeshObject::section(const MeshObject& mesh, bool connectLines, float fMinDist) c
 
 void MeshObject::refine()
 {
+    invalidateCurvature();
     unsigned long cnt = _kernel.CountFacets();
     MeshCore::MeshFacetIterator cF(_kernel);
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
@@ -1361,6 +1405,7 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshRemoveNeedles eval(_kernel, length);
     eval.Fixup();
@@ -1371,12 +1416,14 @@ void MeshObject::removeNeedles(float length)
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
+    invalidateCurvature();
     MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     if (fMaxAngle > 0.0f) {
         topalg.OptimizeTopology(fMaxAngle);
@@ -1392,12 +1439,14 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
+    invalidateCurvature();
     std::vector<std::pair<FacetIndex, FacetIndex>> adjacentFacet;
     MeshCore::MeshAlgorithm alg(_kernel);
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
@@ -1431,24 +1480,28 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(FacetIndex facet, FacetIndex neighbour, const Base::Vector3f& v)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(FacetIndex facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseEdge(facet, neighbour);
 
@@ -1460,6 +1513,7 @@ void MeshObject::collapseEdge(FacetIndex facet, FacetIndex neighbour)
 
 void MeshObject::collapseFacet(FacetIndex facet)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.CollapseFacet(facet);
 
@@ -1470,6 +1524,7 @@ void MeshObject::collapseFacet(FacetIndex facet)
 
 void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     for (FacetIndex it : facets) {
         alg.CollapseFacet(it);
@@ -1480,12 +1535,14 @@ void MeshObject::collapseFacets(const std::vector<FacetIndex>& facets)
 
 void MeshObject::insertVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(FacetIndex facet, const Base::Vector3f& v)
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm topalg(_kernel);
     topalg.SnapVertex(facet, v);
 }
@@ -1499,12 +1556,14 @@ unsigned long MeshObject::countNonUniformOrientedFacets() const
 
 void MeshObject::flipNormals()
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
+    invalidateCurvature();
     MeshCore::MeshTopoAlgorithm alg(_kernel);
     alg.HarmonizeNormals();
 }
@@ -1517,6 +1576,7 @@ bool MeshObject::hasNonManifolds() const
 
 void MeshObject::removeNonManifolds()
 {
+    invalidateCurvature();
     MeshCore::MeshEvalTopology f_eval(_kernel);
     if (!f_eval.Evaluate()) {
         MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
@@ -1527,6 +1587,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
+    invalidateCurvature();
     MeshCore::MeshEvalPointManifolds p_eval(_kernel);
     if (!p_eval.Evaluate()) {
         std::vector<FacetIndex> faces;
@@ -1573,6 +1634,7 @@ MeshObject::getSelfIntersections(const MeshObject::TFacePairs& facets) const
 
 void MeshObject::removeSelfIntersections()
 {
+    invalidateCurvature();
     std::vector<std::pair<FacetIndex, FacetIndex>> selfIntersections;
     MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
     cMeshEval.GetIntersections(selfIntersections);
@@ -1585,6 +1647,7 @@ void MeshObject::removeSelfIntersections()
 
 void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 {
+    invalidateCurvature();
     // make sure that the number of indices is even and are in range
     if (indices.size() % 2 != 0) {
         return;
@@ -1617,6 +1680,7 @@ void MeshObject::removeSelfIntersections(const std::vector<FacetIndex>& indices)
 
 void MeshObject::removeFoldsOnSurface()
 {
+    invalidateCurvature();
     std::vector<FacetIndex> indices;
     MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
     MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
@@ -1651,6 +1715,7 @@ void MeshObject::removeFoldsOnSurface()
 
 void MeshObject::removeFullBoundaryFacets()
 {
+    invalidateCurvature();
     std::vector<FacetIndex> facets;
     if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
         deleteFacets(facets);
@@ -1665,6 +1730,7 @@ bool MeshObject::hasInvalidPoints() const
 
 void MeshObject::removeInvalidPoints()
 {
+    invalidateCurvature();
     MeshCore::MeshEvalNaNPoints nan(_kernel);
     deletePoints(nan.GetIndices());
 }
@@ -1677,12 +1743,14 @@ bool MeshObject::hasPointsOnEdge() const
 
 void MeshObject::removePointsOnEdge(bool fillBoundary)
 {
+    invalidateCurvature();
     MeshCore::MeshFixPointOnEdge nan(_kernel, fillBoundary);
     nan.Fixup();
 }
 
 void MeshObject::mergeFacets()
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixMergeFacets merge(_kernel);
     merge.Fixup();
@@ -1693,6 +1761,7 @@ void MeshObject::mergeFacets()
 
 void MeshObject::validateIndices()
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
 
     // for invalid neighbour indices we don't need to check first
@@ -1749,6 +1818,7 @@ bool MeshObject::hasCorruptedFacets() const
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDeformedFacets eval(_kernel,
                                          Base::toRadians(15.0f),
@@ -1763,6 +1833,7 @@ void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 
 void MeshObject::validateDegenerations(float fEps)
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
     eval.Fixup();
@@ -1773,6 +1844,7 @@ void MeshObject::validateDegenerations(float fEps)
 
 void MeshObject::removeDuplicatedPoints()
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicatePoints eval(_kernel);
     eval.Fixup();
@@ -1783,6 +1855,7 @@ void MeshObject::removeDuplicatedPoints()
 
 void MeshObject::removeDuplicatedFacets()
 {
+    invalidateCurvature();
     unsigned long count = _kernel.CountFacets();
     MeshCore::MeshFixDuplicateFacets eval(_kernel);
     eval.Fixup();
@@ -2132,6 +2205,25 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
     return segm;
 }
 
+void MeshObject::invalidateCurvature()
+{
+    std::lock_guard<std::mutex> lock(_curvatureMutex);
+    _curvature.reset();
+}
+
+std::shared_ptr<const std::vector<MeshCore::CurvatureInfo>> MeshObject::getCurvaturePerVertex() const
+{
+    std::lock_guard<std::mutex> lock(_curvatureMutex);
+    if (!_curvature) {
+        MeshCore::MeshCurvature meshCurv(_kernel);
+        meshCurv.ComputePerVertex();
+        _curvature =
+            std::make_shared<const std::vector<MeshCore::CurvatureInfo>>(meshCurv.GetCurvature());
+    }
+
+    return _curvature;
+}
+
 // ----------------------------------------------------------------------------
 
 MeshObject::const_point_iterator::const_point_iterator(const MeshObject* mesh, PointIndex index)
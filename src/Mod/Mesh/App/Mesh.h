@@ -25,6 +25,8 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -58,6 +60,7 @@ class ViewProjMethod;
 namespace MeshCore
 {
 class AbstractPolygonTriangulator;
+struct CurvatureInfo;
 }
 
 namespace Mesh
@@ -178,6 +181,7 @@ public:
     void setKernel(const MeshCore::MeshKernel& m);
     MeshCore::MeshKernel& getKernel()
     {
+        invalidateCurvature();
         return _kernel;
     }
     const MeshCore::MeshKernel& getKernel() const
@@ -262,8 +266,8 @@ public:
     void movePoint(PointIndex, const Base::Vector3d& v);
     void setPoint(PointIndex, const Base::Vector3d& v);
     void smooth(int iterations, float d_max);
-    void decimate(float fTolerance, float fReduction);
-    void decimate(int targetSize);
+    void decimate(float fTolerance, float fReduction, bool parallel = false);
+    void decimate(int targetSize, bool parallel = false);
     Base::Vector3d getPointNormal(PointIndex) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(const std::vector<TPlane>&,
@@ -361,6 +365,10 @@ public:
     Segment& getSegment(unsigned long);
     MeshObject* meshFromSegment(const std::vector<FacetIndex>&) const;
     std::vector<Segment> getSegmentsOfType(GeometryType, float dev, unsigned long minFacets) const;
+    /** Returns the curvature per vertex. The result is cached until the mesh is modified
+     * or its kernel is accessed for writing.
+     */
+    std::shared_ptr<const std::vector<MeshCore::CurvatureInfo>> getCurvaturePerVertex() const;
     //@}
 
     /** @name Primitives */
@@ -460,6 +468,7 @@ public:
     friend class Segment;
 
 private:
+    void invalidateCurvature();
     void deletedFacets(const std::vector<FacetIndex>& remFacets);
     void updateMesh(const std::vector<FacetIndex>&) const;
     void updateMesh() const;
@@ -471,6 +480,8 @@ private:
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    mutable std::shared_ptr<const std::vector<MeshCore::CurvatureInfo>> _curvature;
+    mutable std::mutex _curvatureMutex;
     static const float Epsilon;
 };
 
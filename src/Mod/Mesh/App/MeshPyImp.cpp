@@ -1987,18 +1987,26 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
     double micro = 0;
     double maximum = 1000;
     int weight = 1;
-    static const std::array<const char*, 7>
-        keywords_smooth {"Method", "Iteration", "Lambda", "Micro", "Maximum", "Weight", nullptr};
+    int threads = 0;
+    static const std::array<const char*, 8> keywords_smooth {"Method",
+                                                             "Iteration",
+                                                             "Lambda",
+                                                             "Micro",
+                                                             "Maximum",
+                                                             "Weight",
+                                                             "Threads",
+                                                             nullptr};
     if (!Base::Wrapped_ParseTupleAndKeywords(args,
                                              kwds,
-                                             "|sidddi",
+                                             "|sidddii",
                                              keywords_smooth,
                                              &method,
                                              &iter,
                                              &lambda,
                                              &micro,
                                              &maximum,
-                                             &weight)) {
+                                             &weight,
+                                             &threads)) {
         return nullptr;
     }
 
@@ -2008,6 +2016,7 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
         MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
         if (strcmp(method, "Laplace") == 0) {
             MeshCore::LaplaceSmoothing smooth(kernel);
+            smooth.SetThreadCount(threads);
             if (lambda > 0) {
                 smooth.SetLambda(lambda);
             }
@@ -2015,6 +2024,7 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
         }
         else if (strcmp(method, "Taubin") == 0) {
             MeshCore::TaubinSmoothing smooth(kernel);
+            smooth.SetThreadCount(threads);
             if (lambda > 0) {
                 smooth.SetLambda(lambda);
             }
@@ -2025,11 +2035,13 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
         }
         else if (strcmp(method, "PlaneFit") == 0) {
             MeshCore::PlaneFitSmoothing smooth(kernel);
+            smooth.SetThreadCount(threads);
             smooth.SetMaximum(maximum);
             smooth.Smooth(iter);
         }
         else if (strcmp(method, "MedianFilter") == 0) {
             MeshCore::MedianFilterSmoothing smooth(kernel);
+            smooth.SetThreadCount(threads);
             smooth.SetWeight(weight);
             smooth.Smooth(iter);
         }
@@ -2045,10 +2057,15 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
 PyObject* MeshPy::decimate(PyObject* args)
 {
     float fTol {}, fRed {};
-    if (PyArg_ParseTuple(args, "ff", &fTol, &fRed)) {
+    PyObject* parallel = Py_False;
+    // A bool converts to a float, so decimate(targetSize, parallel) must not be
+    // parsed as decimate(tolerance, reduction)
+    bool reductionGiven = PyTuple_Size(args) >= 2 && !PyBool_Check(PyTuple_GetItem(args, 1));
+    if (reductionGiven
+        && PyArg_ParseTuple(args, "ff|O!", &fTol, &fRed, &PyBool_Type, &parallel)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(fTol, fRed);
+            getMeshObjectPtr()->decimate(fTol, fRed, Base::asBoolean(parallel));
         }
         PY_CATCH;
 
@@ -2057,10 +2074,10 @@ PyObject* MeshPy::decimate(PyObject* args)
 
     PyErr_Clear();
     int targetSize {};
-    if (PyArg_ParseTuple(args, "i", &targetSize)) {
+    if (PyArg_ParseTuple(args, "i|O!", &targetSize, &PyBool_Type, &parallel)) {
         PY_TRY
         {
-            getMeshObjectPtr()->decimate(targetSize);
+            getMeshObjectPtr()->decimate(targetSize, Base::asBoolean(parallel));
         }
         PY_CATCH;
 
@@ -2068,7 +2085,8 @@ PyObject* MeshPy::decimate(PyObject* args)
     }
 
     PyErr_SetString(PyExc_ValueError,
-                    "decimate(tolerance=float, reduction=float) or decimate(targetSize=int)");
+                    "decimate(tolerance=float, reduction=float, [parallel=bool]) or "
+                    "decimate(targetSize=int, [parallel=bool])");
     return nullptr;
 }
 
@@ -2177,8 +2195,8 @@ PyObject* MeshPy::getSegmentsByCurvature(PyObject* args)
 
     const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
     MeshCore::MeshSegmentAlgorithm finder(kernel);
-    MeshCore::MeshCurvature meshCurv(kernel);
-    meshCurv.ComputePerVertex();
+    finder.setParallel(true);
+    auto curvature = getMeshObjectPtr()->getCurvaturePerVertex();
 
     Py::Sequence func(l);
     std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
@@ -2190,7 +2208,7 @@ PyObject* MeshPy::getSegmentsByCurvature(PyObject* args)
         float tol2 = Py::Float(t[3]);
         int num = (int)Py::Long(t[4]);
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(*curvature,
                                                                      num,
                                                                      tol1,
                                                                      tol2,
@@ -2221,11 +2239,8 @@ PyObject* MeshPy::getCurvaturePerVertex(PyObject* args)
         return nullptr;
     }
 
-    const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
-    MeshCore::MeshCurvature meshCurv(kernel);
-    meshCurv.ComputePerVertex();
-
-    const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
+    auto curvature = getMeshObjectPtr()->getCurvaturePerVertex();
+    const std::vector<MeshCore::CurvatureInfo>& curv = *curvature;
     Base::Placement plm = getMeshObjectPtr()->getPlacement();
     plm.setPosition(Base::Vector3d());
 
@@ -708,6 +708,41 @@ class MeshSubElement(unittest.TestCase):
         pass
 
 
+class MeshDecimation(unittest.TestCase):
+    def testDecimateTolerance(self):
+        mesh = Mesh.createSphere(10.0, 50)
+        count = mesh.CountFacets
+        mesh.decimate(0.5, 0.5)
+        self.assertLess(mesh.CountFacets, count)
+        self.assertGreater(mesh.CountFacets, 0)
+
+    def testDecimateTargetSizeParallel(self):
+        mesh = Mesh.createSphere(10.0, 50)
+        target = mesh.CountFacets // 2
+        # must not be taken as tolerance=target and reduction=1.0
+        mesh.decimate(target, True)
+        self.assertLessEqual(mesh.CountFacets, target)
+        self.assertGreater(mesh.CountFacets, target // 2)
+
+    def testDecimateInvalidArguments(self):
+        mesh = Mesh.createSphere(10.0, 50)
+        with self.assertRaises(ValueError):
+            mesh.decimate(0.5, True)
+
+
+class MeshCurvature(unittest.TestCase):
+    def testCacheFollowsModification(self):
+        mesh = Mesh.createSphere(10.0, 30)
+        curvature = mesh.getCurvaturePerVertex()
+        self.assertAlmostEqual(abs(curvature[0][0]), 0.1, delta=0.02)
+
+        matrix = FreeCAD.Matrix()
+        matrix.scale(2.0, 2.0, 2.0)
+        mesh.transform(matrix)
+        curvature = mesh.getCurvaturePerVertex()
+        self.assertAlmostEqual(abs(curvature[0][0]), 0.05, delta=0.01)
+
+
 class MeshProperty(unittest.TestCase):
     def setUp(self):
         self.doc = FreeCAD.newDocument("MeshTest")
@@ -73,19 +73,27 @@ void Segmentation::accept()
     // make a copy because we might smooth the mesh before
     MeshCore::MeshKernel kernel = mesh->getKernel();
 
+    std::shared_ptr<const std::vector<MeshCore::CurvatureInfo>> curvature;
     if (ui->checkBoxSmooth->isChecked()) {
         MeshCore::LaplaceSmoothing smoother(kernel);
         smoother.Smooth(ui->smoothSteps->value());
+        MeshCore::MeshCurvature meshCurv(kernel);
+        meshCurv.ComputePerVertex();
+        curvature =
+            std::make_shared<const std::vector<MeshCore::CurvatureInfo>>(meshCurv.GetCurvature());
+    }
+    else {
+        // the curvature of the unmodified mesh is cached
+        curvature = mesh->getCurvaturePerVertex();
     }
 
     MeshCore::MeshSegmentAlgorithm finder(kernel);
-    MeshCore::MeshCurvature meshCurv(kernel);
-    meshCurv.ComputePerVertex();
+    finder.setParallel(true);
 
     std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
     if (ui->groupBoxFree->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(*curvature,
                                                                      ui->numFree->value(),
                                                                      ui->tol1Free->value(),
                                                                      ui->tol2Free->value(),
@@ -94,7 +102,7 @@ void Segmentation::accept()
     }
     if (ui->groupBoxCyl->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureCylindricalSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureCylindricalSegment>(*curvature,
                                                                         ui->numCyl->value(),
                                                                         ui->tol1Cyl->value(),
                                                                         ui->tol2Cyl->value(),
@@ -102,14 +110,14 @@ void Segmentation::accept()
     }
     if (ui->groupBoxSph->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureSphericalSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureSphericalSegment>(*curvature,
                                                                       ui->numSph->value(),
                                                                       ui->tolSph->value(),
                                                                       ui->crvSph->value()));
     }
     if (ui->groupBoxPln->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(*curvature,
                                                                    ui->numPln->value(),
                                                                    ui->tolPln->value()));
     }
@@ -50,8 +50,11 @@
 #include <Inventor/misc/SoState.h>
 #endif
 
+#include <Base/BoundBox.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
@@ -618,6 +621,7 @@ void SoFCMeshObjectShape::notify(SoNotList* node)
 {
     inherited::notify(node);
     updateGLArray = true;
+    updateBVH = true;
 }
 
 #define RENDER_GLARRAYS
@@ -1077,11 +1081,160 @@ void SoFCMeshObjectShape::renderSelectionGeometry(const Mesh::MeshObject* mesh)
 
 
 /**
- * Calculates picked point based on primitives generated by subclasses.
+ * Calculates the picked points using a bounding volume hierarchy of the facets so that
+ * only the facets of the leaves hit by the ray must be tested.
  */
 void SoFCMeshObjectShape::rayPick(SoRayPickAction* action)
 {
-    inherited::rayPick(action);
+    if (!shouldRayPick(action)) {
+        return;
+    }
+
+    SoState* state = action->getState();
+    const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
+    if (!mesh || mesh->countPoints() < 3 || mesh->countFacets() == 0) {
+        return;
+    }
+
+    computeObjectSpaceRay(action);
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    Binding mbind = this->findMaterialBinding(state);
+    uint32_t nodeId = SoFCMeshObjectElement::getInstance(state)->getNodeId();
+
+    // Only the triangles of the leaves hit by the ray are tested
+    auto testBox = [action](const SbBox3f& box) {
+        return action->intersect(box, TRUE) ? Gui::Inventor::TriangleBVH::Overlap::Partial
+                                             : Gui::Inventor::TriangleBVH::Overlap::Outside;
+    };
+    auto testFacet = [&](std::size_t index, bool) {
+        const MeshCore::MeshFacet& rFacet = rFacets[index];
+        SbVec3f v0 = sbvec3f(rPoints[rFacet._aulPoints[0]]);
+        SbVec3f v1 = sbvec3f(rPoints[rFacet._aulPoints[1]]);
+        SbVec3f v2 = sbvec3f(rPoints[rFacet._aulPoints[2]]);
+
+        SbVec3f isect;
+        SbVec3f barycentric;
+        SbBool front {};
+        if (!action->intersect(v0, v1, v2, isect, barycentric, front)
+            || !action->isBetweenPlanes(isect)) {
+            return;
+        }
+
+        SoPickedPoint* pp = action->addIntersection(isect);
+        if (!pp) {
+            return;
+        }
+
+        SbVec3f normal = (v1 - v0).cross(v2 - v0);
+        normal.normalize();
+        pp->setObjectNormal(normal);
+
+        auto detail = new SoFaceDetail();
+        detail->setFaceIndex(static_cast<int32_t>(index));
+        detail->setNumPoints(3);
+        SoPointDetail pointDetail;
+        for (int i = 0; i < 3; i++) {
+            auto pointIndex = static_cast<int32_t>(rFacet._aulPoints[i]);
+            pointDetail.setCoordinateIndex(pointIndex);
+            if (mbind == PER_VERTEX_INDEXED || mbind == PER_FACE_INDEXED) {
+                pointDetail.setMaterialIndex(pointIndex);
+            }
+            detail->setPoint(i, &pointDetail);
+        }
+        if (mbind == PER_VERTEX_INDEXED || mbind == PER_FACE_INDEXED) {
+            pp->setMaterialIndex(static_cast<int32_t>(rFacet._aulPoints[0]));
+        }
+        pp->setDetail(detail, this);
+    };
+
+    try {
+        getBVH(mesh, nodeId).traverse(testBox, testFacet);
+    }
+    catch (const Base::MemoryException&) {
+        Base::Console().Log("Not enough memory to build picking hierarchy\n");
+    }
+}
+
+/**
+ * Returns the bounding volume hierarchy of the facets of \a mesh. The hierarchy is
+ * only rebuilt if the mesh node or the node itself has changed since the last call.
+ */
+const Gui::Inventor::TriangleBVH&
+SoFCMeshObjectShape::getBVH(const Mesh::MeshObject* mesh, uint32_t nodeId)
+{
+    if (updateBVH || bvhMesh != mesh || bvhNodeId != nodeId
+        || bvh.countTriangles() != mesh->countFacets()) {
+        const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+        const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+        bvh.build(rFacets.size(),
+                  [&rPoints, &rFacets](std::size_t index, SbVec3f& v0, SbVec3f& v1, SbVec3f& v2) {
+                      const MeshCore::MeshFacet& rFacet = rFacets[index];
+                      v0 = sbvec3f(rPoints[rFacet._aulPoints[0]]);
+                      v1 = sbvec3f(rPoints[rFacet._aulPoints[1]]);
+                      v2 = sbvec3f(rPoints[rFacet._aulPoints[2]]);
+                  });
+        bvhMesh = mesh;
+        bvhNodeId = nodeId;
+        updateBVH = false;
+    }
+
+    return bvh;
+}
+
+/**
+ * Does the same as MeshAlgorithm::CheckFacets() but skips all parts of the mesh whose
+ * projected bounding box doesn't intersect with the bounding box of \a polygon.
+ */
+void SoFCMeshObjectShape::getFacetsFromPolygon(const Mesh::MeshObject* mesh,
+                                               uint32_t nodeId,
+                                               const Base::ViewProjMethod& proj,
+                                               const Base::Polygon2d& polygon,
+                                               std::vector<Mesh::FacetIndex>& indices)
+{
+    if (!mesh || mesh->countFacets() == 0) {
+        return;
+    }
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    // Precompute the screen projection matrix as Coin's projection function is expensive
+    Base::Matrix4D projMat = proj.getComposedProjectionMatrix();
+    Base::ViewProjMatrix fixedProj(projMat);
+    Base::BoundBox2d polyBox = polygon.CalcBoundBox();
+
+    auto testBox = [&projMat, &fixedProj, &polyBox](const SbBox3f& box) {
+        const SbVec3f& minPt = box.getMin();
+        const SbVec3f& maxPt = box.getMax();
+        Base::BoundBox3f box3d(minPt[0], minPt[1], minPt[2], maxPt[0], maxPt[1], maxPt[2]);
+        // With a perspective projection the projected corners of a box that reaches
+        // behind the eye plane are mirrored, so such a box must not be culled
+        for (int i = 0; i < 8; i++) {
+            Base::Vector3f pt = box3d.CalcPoint(i);
+            double w = projMat[3][0] * pt.x + projMat[3][1] * pt.y + projMat[3][2] * pt.z
+                + projMat[3][3];
+            if (w <= 0.0) {
+                return Gui::Inventor::TriangleBVH::Overlap::Partial;
+            }
+        }
+        Base::BoundBox2d viewBox = box3d.ProjectBox(&fixedProj);
+        return viewBox.Intersect(polyBox) ? Gui::Inventor::TriangleBVH::Overlap::Partial
+                                          : Gui::Inventor::TriangleBVH::Overlap::Outside;
+    };
+    auto testFacet = [&](std::size_t index, bool) {
+        for (Mesh::PointIndex ptIndex : rFacets[index]._aulPoints) {
+            Base::Vector3f pt2d = fixedProj(rPoints[ptIndex]);
+            Base::Vector2d pt(pt2d.x, pt2d.y);
+            if (polyBox.Contains(pt) && polygon.Contains(pt)) {
+                indices.push_back(index);
+                break;
+            }
+        }
+    };
+
+    getBVH(mesh, nodeId).traverse(testBox, testFacet);
+    std::sort(indices.begin(), indices.end());
 }
 
 /** Sets the point indices, the geometric points and the normal for each triangle.
@@ -29,6 +29,7 @@
 #include <Inventor/fields/SoSFVec3s.h>
 #include <Inventor/fields/SoSField.h>
 #include <Inventor/nodes/SoShape.h>
+#include <Gui/Inventor/TriangleBVH.h>
 #include <Mod/Mesh/App/Mesh.h>
 
 
@@ -36,6 +37,12 @@ using GLuint = unsigned int;
 using GLint = int;
 using GLfloat = float;
 
+namespace Base
+{
+class Polygon2d;
+class ViewProjMethod;
+}
+
 namespace MeshCore
 {
 class MeshFacetGrid;
@@ -186,6 +193,14 @@ public:
 
     unsigned int renderTriangleLimit;  // NOLINT
 
+    /// Collects the facets of which at least one projected point lies inside \a polygon,
+    /// \a nodeId is the current node id of the mesh node providing \a mesh
+    void getFacetsFromPolygon(const Mesh::MeshObject* mesh,
+                              uint32_t nodeId,
+                              const Base::ViewProjMethod& proj,
+                              const Base::Polygon2d& polygon,
+                              std::vector<Mesh::FacetIndex>& indices);
+
 protected:
     void doAction(SoAction* action) override;
     void GLRender(SoGLRenderAction* action) override;
@@ -230,6 +245,8 @@ private:
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
 
+    const Gui::Inventor::TriangleBVH& getBVH(const Mesh::MeshObject*, uint32_t nodeId);
+
 private:
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
@@ -238,6 +255,11 @@ private:
     std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
     SbBool updateGLArray {false};
+    // Hierarchy for picking, rebuilt on demand
+    Gui::Inventor::TriangleBVH bvh;
+    const Mesh::MeshObject* bvhMesh {nullptr};
+    uint32_t bvhNodeId {0};
+    SbBool updateBVH {true};
 };
 
 class MeshGuiExport SoFCMeshSegmentShape: public SoShape
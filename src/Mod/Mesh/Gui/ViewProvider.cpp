@@ -1354,8 +1354,21 @@ void ViewProviderMesh::getFacetsFromPolygon(const std::vector<SbVec2f>& picked,
 
     // Get the attached mesh property
     Mesh::PropertyMeshKernel& meshProp = static_cast<Mesh::Feature*>(pcObject)->Mesh;
-    MeshCore::MeshAlgorithm cAlg(meshProp.getValue().getKernel());
-    cAlg.CheckFacets(&proj, polygon, true, indices);
+    SoShape* shape = getShapeNode();
+    SoNode* coords = getCoordNode();
+    if (shape && coords && shape->isOfType(SoFCMeshObjectShape::getClassTypeId())) {
+        // use the picking hierarchy of the shape node to skip invisible parts, the
+        // current id of the mesh node detects in-place modifications of the mesh
+        static_cast<SoFCMeshObjectShape*>(shape)->getFacetsFromPolygon(&meshProp.getValue(),
+                                                                        coords->getNodeId(),
+                                                                        proj,
+                                                                        polygon,
+                                                                        indices);
+    }
+    else {
+        MeshCore::MeshAlgorithm cAlg(meshProp.getValue().getKernel());
+        cAlg.CheckFacets(&proj, polygon, true, indices);
+    }
 
     if (!inner) {
         // get the indices that are completely outside
@@ -42,6 +42,8 @@
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <gp_Pln.hxx>
+
+#include <QThread>
 #endif
 
 #include <Base/Console.h>
@@ -50,6 +52,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -66,6 +69,55 @@ using MeshCore::MeshFacetIterator;
 using MeshCore::MeshKernel;
 using MeshCore::MeshPointIterator;
 
+namespace
+{
+// Calls func(i) for all i in [0, count) concurrently. The indices are processed in blocks so
+// that the progress bar, which must only be used by the calling thread, is updated in between.
+template<typename Func>
+void parallelFor(std::size_t count, Base::SequencerLauncher* seq, Func func)
+{
+    std::size_t numThreads = std::max(QThread::idealThreadCount(), 1);
+    std::size_t blockSize = std::max(numThreads, count / 100 + 1);
+    for (std::size_t first = 0; first < count; first += blockSize) {
+        std::size_t last = std::min(first + blockSize, count);
+        MeshCore::parallel_for(
+            last - first,
+            [first, &func](std::size_t begin, std::size_t end) {
+                for (std::size_t i = first + begin; i < first + end; i++) {
+                    func(i);
+                }
+            },
+            0,
+            1);
+        if (seq) {
+            seq->setProgress(last);
+        }
+    }
+}
+
+template<typename Func>
+void serialFor(std::size_t count, Base::SequencerLauncher* seq, Func func)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        func(i);
+        if (seq) {
+            seq->next();
+        }
+    }
+}
+
+std::vector<TopoDS_Edge> getEdges(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Edge> edges;
+    for (TopExp_Explorer xp(shape, TopAbs_EDGE); xp.More(); xp.Next()) {
+        edges.push_back(TopoDS::Edge(xp.Current()));
+    }
+    return edges;
+}
+
+using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
+}  // namespace
+
 CurveProjector::CurveProjector(const TopoDS_Shape& aShape, const MeshKernel& pMesh)
     : _Shape(aShape)
     , _Mesh(pMesh)
@@ -100,18 +152,47 @@ CurveProjectorShape::CurveProjectorShape(const TopoDS_Shape& aShape, const MeshK
 
 void CurveProjectorShape::Do()
 {
-    TopExp_Explorer Ex;
-    for (Ex.Init(_Shape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
+    std::vector<TopoDS_Edge> edges = getEdges(_Shape);
+    std::vector<std::vector<FaceSplitEdge>> splitEdges(edges.size());
+    std::vector<std::vector<std::string>> messages(edges.size());
+
+    // with several edges they are projected concurrently, otherwise the search of the start
+    // point is done in parallel
+    bool parallelEdges = edges.size() > 1;
+    auto project = [&](std::size_t i) {
+        projectCurve(edges[i], splitEdges[i], !parallelEdges, messages[i]);
+    };
+    if (parallelEdges) {
+        parallelFor(edges.size(), nullptr, project);
+    }
+    else {
+        serialFor(edges.size(), nullptr, project);
+    }
 
-        // std::vector<FaceSplitEdge> vSplitEdges;
-        projectCurve(aEdge, mvEdgeSplitPoints[aEdge]);
+    // keep the order of the explorer, an edge may be visited more than once
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        for (const auto& msg : messages[i]) {
+            Base::Console().Log("%s", msg.c_str());
+        }
+        auto& vSplitEdges = mvEdgeSplitPoints[edges[i]];
+        vSplitEdges.insert(vSplitEdges.end(), splitEdges[i].begin(), splitEdges[i].end());
     }
 }
 
-
 void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
                                        std::vector<FaceSplitEdge>& vSplitEdges)
+{
+    std::vector<std::string> messages;
+    projectCurve(aEdge, vSplitEdges, true, messages);
+    for (const auto& msg : messages) {
+        Base::Console().Log("%s", msg.c_str());
+    }
+}
+
+void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
+                                       std::vector<FaceSplitEdge>& vSplitEdges,
+                                       bool parallel,
+                                       std::vector<std::string>& messages)
 {
     Standard_Real fFirst, fLast;
     Handle(Geom_Curve) hCurve = BRep_Tool::Curve(aEdge, fFirst, fLast);
@@ -128,7 +209,7 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
     MeshCore::FacetIndex auNeighboursIdx[3];
     bool GoOn;
 
-    if (!findStartPoint(_Mesh, cStartPoint, cResultPoint, uStartFacetIdx)) {
+    if (!findStartPoint(_Mesh, cStartPoint, cResultPoint, uStartFacetIdx, parallel)) {
         return;
     }
 
@@ -198,10 +279,10 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
                 }
                 else if (Alg.NbPoints() > 1) {
                     PointOnEdge[i] = Base::Vector3f(FLOAT_MAX, 0, 0);
-                    Base::Console().Log("MeshAlgos::projectCurve(): More then one intersection in "
-                                        "Facet %lu, Edge %d\n",
-                                        uCurFacetIdx,
-                                        i);
+                    messages.push_back(fmt::sprintf("MeshAlgos::projectCurve(): More then one "
+                                                    "intersection in Facet %lu, Edge %d\n",
+                                                    uCurFacetIdx,
+                                                    i));
                 }
             }
         }
@@ -219,8 +300,9 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
             GoOn = true;
         }
         else {
-            Base::Console().Log("MeshAlgos::projectCurve(): Possible reentry in Facet %lu\n",
-                                uCurFacetIdx);
+            messages.push_back(
+                fmt::sprintf("MeshAlgos::projectCurve(): Possible reentry in Facet %lu\n",
+                             uCurFacetIdx));
         }
 
         if (uCurFacetIdx == uStartFacetIdx) {
@@ -233,27 +315,64 @@ void CurveProjectorShape::projectCurve(const TopoDS_Edge& aEdge,
 bool CurveProjectorShape::findStartPoint(const MeshKernel& MeshK,
                                          const Base::Vector3f& Pnt,
                                          Base::Vector3f& Rslt,
-                                         MeshCore::FacetIndex& FaceIndex)
+                                         MeshCore::FacetIndex& FaceIndex,
+                                         bool parallel)
 {
-    Base::Vector3f TempResultPoint;
-    float MinLength = FLOAT_MAX;
-    bool bHit = false;
-
-    // go through the whole Mesh
-    MeshFacetIterator It(MeshK);
-    for (It.Init(); It.More(); It.Next()) {
-        // try to project (with angle) to the face
-        if (It->Foraminate(Pnt, It->GetNormal(), TempResultPoint)) {
-            // distance to the projected point
-            float Dist = (Pnt - TempResultPoint).Length();
-            if (Dist < MinLength) {
-                // remember the point with the closest distance
-                bHit = true;
-                MinLength = Dist;
-                Rslt = TempResultPoint;
-                FaceIndex = It.Position();
+    struct Hit
+    {
+        float MinLength = FLOAT_MAX;
+        Base::Vector3f Point;
+        MeshCore::FacetIndex Index = MeshCore::FACET_INDEX_MAX;
+    };
+
+    // go through a range of the mesh
+    auto searchRange = [&MeshK, &Pnt](MeshCore::FacetIndex first, MeshCore::FacetIndex last) {
+        Hit hit;
+        Base::Vector3f TempResultPoint;
+        for (MeshCore::FacetIndex index = first; index < last; index++) {
+            MeshGeomFacet facet = MeshK.GetFacet(index);
+            // try to project (with angle) to the face
+            if (facet.Foraminate(Pnt, facet.GetNormal(), TempResultPoint)) {
+                // distance to the projected point
+                float Dist = (Pnt - TempResultPoint).Length();
+                if (Dist < hit.MinLength) {
+                    // remember the point with the closest distance
+                    hit.MinLength = Dist;
+                    hit.Point = TempResultPoint;
+                    hit.Index = index;
+                }
             }
         }
+        return hit;
+    };
+
+    std::size_t numFacets = MeshK.CountFacets();
+    std::size_t numRanges = parallel ? std::max(QThread::idealThreadCount(), 1) * 4 : 1;
+    numRanges = std::max<std::size_t>(1, std::min(numRanges, numFacets / 1000));
+    std::size_t rangeSize = (numFacets + numRanges - 1) / numRanges;
+
+    std::vector<Hit> hits(numRanges);
+    auto search = [&](std::size_t i) {
+        hits[i] = searchRange(std::min(i * rangeSize, numFacets),
+                              std::min((i + 1) * rangeSize, numFacets));
+    };
+    if (numRanges > 1) {
+        parallelFor(numRanges, nullptr, search);
+    }
+    else {
+        search(0);
+    }
+
+    // the first of equally distant facets wins as with a serial search
+    bool bHit = false;
+    float MinLength = FLOAT_MAX;
+    for (const auto& hit : hits) {
+        if (hit.Index != MeshCore::FACET_INDEX_MAX && hit.MinLength < MinLength) {
+            bHit = true;
+            MinLength = hit.MinLength;
+            Rslt = hit.Point;
+            FaceIndex = hit.Index;
+        }
     }
     return bHit;
 }
@@ -682,6 +801,37 @@ MeshProjection::MeshProjection(const MeshKernel& rMesh)
     : _rcMesh(rMesh)
 {}
 
+MeshProjection::~MeshProjection() = default;
+
+void MeshProjection::invalidateGrid()
+{
+    _grid.reset();
+}
+
+const MeshFacetGrid& MeshProjection::getGrid() const
+{
+    // the mesh may have been modified since the grid was built
+    const Base::BoundBox3f& box = _rcMesh.GetBoundBox();
+    if (_grid
+        && (_gridFacets != _rcMesh.CountFacets() || _gridPoints != _rcMesh.CountPoints()
+            || _gridBox.MinX != box.MinX || _gridBox.MinY != box.MinY
+            || _gridBox.MinZ != box.MinZ || _gridBox.MaxX != box.MaxX
+            || _gridBox.MaxY != box.MaxY || _gridBox.MaxZ != box.MaxZ)) {
+        _grid.reset();
+    }
+
+    // calculate the average edge length and create a grid
+    if (!_grid) {
+        MeshAlgorithm clAlg(_rcMesh);
+        float fAvgLen = clAlg.GetAverageEdgeLength();
+        _grid = std::make_unique<MeshFacetGrid>(_rcMesh, 5.0f * fAvgLen);
+        _gridFacets = _rcMesh.CountFacets();
+        _gridPoints = _rcMesh.CountPoints();
+        _gridBox = box;
+    }
+    return *_grid;
+}
+
 void MeshProjection::discretize(const TopoDS_Edge& aEdge,
                                 std::vector<Base::Vector3f>& polyline,
                                 std::size_t minPoints) const
@@ -821,32 +971,43 @@ void MeshProjection::projectToMesh(const TopoDS_Shape& aShape,
                                    float fMaxDist,
                                    std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-
-    TopExp_Explorer Ex;
+    const MeshFacetGrid& cGrid = getGrid();
+    std::vector<TopoDS_Edge> edges = getEdges(aShape);
+    std::vector<PolyLine> polylines(edges.size());
+    std::vector<std::size_t> numAmbiguous(edges.size());
 
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
-    }
-
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
+    Base::SequencerLauncher seq("Project curve on mesh", edges.size());
 
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
+    // with only a few edges the mesh edges of a curve are checked in parallel instead
+    bool parallelEdges = parallel && edges.size() >= std::size_t(QThread::idealThreadCount());
+    auto project = [&](std::size_t i) {
         std::vector<SplitEdge> rSplitEdges;
-        projectEdgeToEdge(aEdge, fMaxDist, cGrid, rSplitEdges);
-        PolyLine polyline;
+        numAmbiguous[i] = projectEdgeToEdge(edges[i],
+                                            fMaxDist,
+                                            cGrid,
+                                            rSplitEdges,
+                                            parallel && !parallelEdges);
+        PolyLine& polyline = polylines[i];
         polyline.points.reserve(rSplitEdges.size());
-        for (auto it : rSplitEdges) {
+        for (const auto& it : rSplitEdges) {
             polyline.points.push_back(it.cPt);
         }
-        rPolyLines.push_back(polyline);
-        seq.next();
+    };
+
+    if (parallelEdges) {
+        parallelFor(edges.size(), &seq, project);
     }
+    else {
+        serialFor(edges.size(), &seq, project);
+    }
+
+    for (std::size_t num : numAmbiguous) {
+        for (std::size_t i = 0; i < num; i++) {
+            Base::Console().Log("More than one possible intersection points\n");
+        }
+    }
+
+    rPolyLines.insert(rPolyLines.end(), polylines.begin(), polylines.end());
 }
 
 void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
@@ -854,10 +1015,8 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                    float tolerance,
                                    std::vector<Base::Vector3f>& pointsOut) const
 {
-    // calculate the average edge length and create a grid
     MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    const MeshFacetGrid& cGrid = getGrid();
 
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
@@ -881,18 +1040,22 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
 
     Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
 
-    for (auto it : pointsIn) {
+    // each input point gives at most one output point
+    std::vector<std::pair<bool, Base::Vector3f>> projected(pointsIn.size());
+    auto project = [&](std::size_t i) {
+        const Base::Vector3f& it = pointsIn[i];
+        auto& out = projected[i];
         Base::Vector3f result;
         MeshCore::FacetIndex index;
         if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
             MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
-                    pointsOut.push_back(result);
+                    out = {true, result};
                 }
             }
             else {
-                pointsOut.push_back(result);
+                out = {true, result};
             }
         }
         else {
@@ -907,7 +1070,7 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                             });
 
             if (boundaryPnt != boundaryPoints.end()) {
-                pointsOut.push_back(*boundaryPnt);
+                out = {true, *boundaryPnt};
             }
             else {
                 // go through the boundary edges and check if the point can be directly projected
@@ -920,14 +1083,25 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                     Base::Vector3f vec = result1 - it;
                     float angle = vec.GetAngle(dir);
                     if (dot <= 0 && angle < 1e-6f) {
-                        pointsOut.push_back(result1);
+                        out = {true, result1};
                         break;
                     }
                 }
             }
         }
+    };
 
-        seq.next();
+    if (parallel) {
+        parallelFor(pointsIn.size(), &seq, project);
+    }
+    else {
+        serialFor(pointsIn.size(), &seq, project);
+    }
+
+    for (const auto& it : projected) {
+        if (it.first) {
+            pointsOut.push_back(it.second);
+        }
     }
 }
 
@@ -935,118 +1109,126 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-    TopExp_Explorer Ex;
-
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
+    std::vector<TopoDS_Edge> edges = getEdges(aShape);
+    std::vector<std::vector<Base::Vector3f>> polylines(edges.size());
+    auto sample = [&](std::size_t i) {
+        discretize(edges[i], polylines[i], 5);
+    };
+
+    if (parallel) {
+        parallelFor(edges.size(), nullptr, sample);
     }
-
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
-
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        std::vector<Base::Vector3f> points;
-        discretize(aEdge, points, 5);
-
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
-        std::vector<HitPoint> hitPoints;
-        using HitPoints = std::pair<HitPoint, HitPoint>;
-        std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
-
-                if (hitPoints.size() > 1) {
-                    HitPoint p1 = hitPoints[hitPoints.size() - 2];
-                    HitPoint p2 = hitPoints[hitPoints.size() - 1];
-                    hitPointPairs.emplace_back(p1, p2);
-                }
-            }
-        }
-
-        MeshCore::MeshProjection meshProjection(_rcMesh);
-        PolyLine polyline;
-        for (auto it : hitPointPairs) {
-            points.clear();
-            if (meshProjection.projectLineOnMesh(cGrid,
-                                                 it.first.first,
-                                                 it.first.second,
-                                                 it.second.first,
-                                                 it.second.second,
-                                                 dir,
-                                                 points)) {
-                polyline.points.insert(polyline.points.end(), points.begin(), points.end());
-            }
-        }
-        rPolyLines.push_back(polyline);
-
-        seq.next();
+    else {
+        serialFor(edges.size(), nullptr, sample);
     }
+
+    projectPolylinesParallel(polylines, dir, rPolyLines);
 }
 
 void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
+    std::vector<std::vector<Base::Vector3f>> polylines;
+    polylines.reserve(aEdges.size());
+    for (const auto& it : aEdges) {
+        polylines.push_back(it.points);
+    }
+
+    projectPolylinesParallel(polylines, dir, rPolyLines);
+}
+
+void MeshProjection::projectPolylinesParallel(
+    const std::vector<std::vector<Base::Vector3f>>& polylines,
+    const Base::Vector3f& dir,
+    std::vector<PolyLine>& rPolyLines) const
+{
     MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    const MeshFacetGrid& cGrid = getGrid();
+
+    // The work is done in flat lists over all polylines so that a few long polylines are
+    // spread over all threads as well as many short ones.
+    std::vector<std::pair<std::size_t, std::size_t>> samples;
+    for (std::size_t i = 0; i < polylines.size(); i++) {
+        for (std::size_t j = 0; j < polylines[i].size(); j++) {
+            samples.emplace_back(i, j);
+        }
+    }
 
-    Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
+    // shoot the rays of all sample points
+    std::vector<std::pair<bool, HitPoint>> rayHits(samples.size());
+    auto shootRay = [&](std::size_t i) {
+        const Base::Vector3f& pnt = polylines[samples[i].first][samples[i].second];
+        HitPoint& hit = rayHits[i].second;
+        rayHits[i].first = clAlg.NearestFacetOnRay(pnt, dir, cGrid, hit.first, hit.second);
+    };
 
-    for (const auto& it : aEdges) {
-        std::vector<Base::Vector3f> points = it.points;
-
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
-        std::vector<HitPoint> hitPoints;
-        using HitPoints = std::pair<HitPoint, HitPoint>;
-        std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
-
-                if (hitPoints.size() > 1) {
-                    HitPoint p1 = hitPoints[hitPoints.size() - 2];
-                    HitPoint p2 = hitPoints[hitPoints.size() - 1];
-                    hitPointPairs.emplace_back(p1, p2);
-                }
+    // connect consecutive hit points of a polyline
+    struct Segment
+    {
+        std::size_t polyline;
+        HitPoint p1, p2;
+        bool valid {false};
+        std::vector<Base::Vector3f> points;
+    };
+    std::vector<Segment> segments;
+    auto connectHits = [&]() {
+        std::size_t last = samples.size();
+        for (std::size_t i = 0; i < samples.size(); i++) {
+            if (!rayHits[i].first) {
+                continue;
             }
+            if (last < samples.size() && samples[last].first == samples[i].first) {
+                Segment segm;
+                segm.polyline = samples[i].first;
+                segm.p1 = rayHits[last].second;
+                segm.p2 = rayHits[i].second;
+                segments.push_back(segm);
+            }
+            last = i;
         }
+    };
 
+    auto projectSegment = [&](std::size_t i) {
+        Segment& segm = segments[i];
         MeshCore::MeshProjection meshProjection(_rcMesh);
-        PolyLine polyline;
-        for (auto it : hitPointPairs) {
-            points.clear();
-            if (meshProjection.projectLineOnMesh(cGrid,
-                                                 it.first.first,
-                                                 it.first.second,
-                                                 it.second.first,
-                                                 it.second.second,
-                                                 dir,
-                                                 points)) {
-                polyline.points.insert(polyline.points.end(), points.begin(), points.end());
-            }
-        }
-        rPolyLines.push_back(polyline);
+        segm.valid = meshProjection.projectLineOnMesh(cGrid,
+                                                      segm.p1.first,
+                                                      segm.p1.second,
+                                                      segm.p2.first,
+                                                      segm.p2.second,
+                                                      dir,
+                                                      segm.points);
+    };
+
+    if (parallel) {
+        parallelFor(samples.size(), nullptr, shootRay);
+        connectHits();
+        Base::SequencerLauncher seq("Project curve on mesh", segments.size());
+        parallelFor(segments.size(), &seq, projectSegment);
+    }
+    else {
+        serialFor(samples.size(), nullptr, shootRay);
+        connectHits();
+        Base::SequencerLauncher seq("Project curve on mesh", segments.size());
+        serialFor(segments.size(), &seq, projectSegment);
+    }
 
-        seq.next();
+    std::vector<PolyLine> result(polylines.size());
+    for (const auto& segm : segments) {
+        if (segm.valid) {
+            auto& points = result[segm.polyline].points;
+            points.insert(points.end(), segm.points.begin(), segm.points.end());
+        }
     }
+    rPolyLines.insert(rPolyLines.end(), result.begin(), result.end());
 }
 
-void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
-                                       float fMaxDist,
-                                       const MeshFacetGrid& rGrid,
-                                       std::vector<SplitEdge>& rSplitEdges) const
+std::size_t MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
+                                              float fMaxDist,
+                                              const MeshFacetGrid& rGrid,
+                                              std::vector<SplitEdge>& rSplitEdges,
+                                              bool parallelSearch) const
 {
     std::vector<MeshCore::FacetIndex> auFInds;
     std::map<std::pair<MeshCore::PointIndex, MeshCore::PointIndex>, std::list<MeshCore::FacetIndex>>
@@ -1075,9 +1257,6 @@ void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
         }
     }
 
-    // sort intersection points by parameter
-    std::map<Standard_Real, SplitEdge> rParamSplitEdges;
-
     BRepAdaptor_Curve clCurve(aEdge);
     Standard_Real fFirst = clCurve.FirstParameter();
     Standard_Real fLast = clCurve.LastParameter();
@@ -1087,26 +1266,36 @@ void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
     //  Bnd_Box clBB;
     //  BndLib_Add3dCurve::Add( BRepAdaptor_Curve(aEdge), 0.0, clBB );
 
-    MeshPointIterator cPI(_rcMesh);
-    MeshFacetIterator cFI(_rcMesh);
+    // the mesh edges are intersected independently of each other
+    struct EdgeResult
+    {
+        bool found {false};
+        bool ambiguous {false};
+        Standard_Real param {0};
+        SplitEdge splitEdge;
+    };
+    using EdgeToFace = std::pair<const std::pair<MeshCore::PointIndex, MeshCore::PointIndex>,
+                                 std::list<MeshCore::FacetIndex>>;
+    std::vector<const EdgeToFace*> meshEdges;
+    meshEdges.reserve(pEdgeToFace.size());
+    for (const auto& it : pEdgeToFace) {
+        meshEdges.push_back(&it);
+    }
+    std::vector<EdgeResult> results(meshEdges.size());
 
-    Base::SequencerLauncher seq("Project curve on mesh", pEdgeToFace.size());
-    std::map<std::pair<MeshCore::PointIndex, MeshCore::PointIndex>,
-             std::list<MeshCore::FacetIndex>>::iterator it;
-    for (it = pEdgeToFace.begin(); it != pEdgeToFace.end(); ++it) {
-        seq.next();
+    auto intersect = [&](std::size_t index) {
+        const EdgeToFace* it = meshEdges[index];
+        EdgeResult& res = results[index];
 
         // edge points
         MeshCore::PointIndex uE0 = it->first.first;
-        cPI.Set(uE0);
-        Base::Vector3f cE0 = *cPI;
+        Base::Vector3f cE0 = _rcMesh.GetPoint(uE0);
         MeshCore::PointIndex uE1 = it->first.second;
-        cPI.Set(uE1);
-        Base::Vector3f cE1 = *cPI;
+        Base::Vector3f cE1 = _rcMesh.GetPoint(uE1);
 
         const std::list<MeshCore::FacetIndex>& auFaces = it->second;
         if (auFaces.size() > 2) {
-            continue;  // non-manifold edge -> don't handle this
+            return;  // non-manifold edge -> don't handle this
         }
         //      if ( clBB.IsOut( gp_Pnt(cE0.x, cE0.y, cE0.z) ) && clBB.IsOut( gp_Pnt(cE1.x, cE1.y,
         //      cE1.z) ) )
@@ -1114,8 +1303,7 @@ void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
 
         Base::Vector3f cEdgeNormal;
         for (MeshCore::FacetIndex itF : auFaces) {
-            cFI.Set(itF);
-            cEdgeNormal += cFI->GetNormal();
+            cEdgeNormal += _rcMesh.GetFacet(itF).GetNormal();
         }
 
         // create a plane from the edge normal and point
@@ -1143,11 +1331,11 @@ void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
                     float fDist = Base::Distance(cP0, cSplitPoint);
 
                     if (fDist <= fMaxDist) {
-                        SplitEdge splitEdge;
-                        splitEdge.uE0 = uE0;
-                        splitEdge.uE1 = uE1;
-                        splitEdge.cPt = cSplitPoint;
-                        rParamSplitEdges[fW] = splitEdge;
+                        res.found = true;
+                        res.param = fW;
+                        res.splitEdge.uE0 = uE0;
+                        res.splitEdge.uE1 = uE1;
+                        res.splitEdge.cPt = cSplitPoint;
                     }
                 }
             }
@@ -1179,21 +1367,42 @@ void MeshProjection::projectEdgeToEdge(const TopoDS_Edge& aEdge,
 
                 // ok, only one sensible solution
                 if (nCntSol == 1) {
-                    SplitEdge splitEdge;
-                    splitEdge.uE0 = uE0;
-                    splitEdge.uE1 = uE1;
-                    splitEdge.cPt = cSplitPoint;
-                    rParamSplitEdges[fSol] = splitEdge;
+                    res.found = true;
+                    res.param = fSol;
+                    res.splitEdge.uE0 = uE0;
+                    res.splitEdge.uE1 = uE1;
+                    res.splitEdge.cPt = cSplitPoint;
                 }
                 else if (nCntSol > 1) {
-                    Base::Console().Log("More than one possible intersection points\n");
+                    res.ambiguous = true;
                 }
             }
         }
+    };
+
+    if (parallelSearch) {
+        parallelFor(meshEdges.size(), nullptr, intersect);
+    }
+    else {
+        serialFor(meshEdges.size(), nullptr, intersect);
+    }
+
+    // sort intersection points by parameter
+    std::size_t numAmbiguous = 0;
+    std::map<Standard_Real, SplitEdge> rParamSplitEdges;
+    for (const auto& res : results) {
+        if (res.found) {
+            rParamSplitEdges[res.param] = res.splitEdge;
+        }
+        else if (res.ambiguous) {
+            numAmbiguous++;
+        }
     }
 
     // sorted by parameter
     for (const auto& itS : rParamSplitEdges) {
         rSplitEdges.push_back(itS.second);
     }
+
+    return numAmbiguous;
 }
@@ -27,6 +27,8 @@
 #include <gts.h>
 #endif
 
+#include <memory>
+#include <string>
 #include <TopoDS_Edge.hxx>
 
 #include <Mod/Mesh/App/Mesh.h>
@@ -103,14 +105,22 @@ public:
 
     void projectCurve(const TopoDS_Edge& aEdge, std::vector<FaceSplitEdge>& vSplitEdges);
 
+    /// Searches the facet the point projects to along its normal, with  parallel the
+    /// facets are tested concurrently
     bool findStartPoint(const MeshKernel& MeshK,
                         const Base::Vector3f& Pnt,
                         Base::Vector3f& Rslt,
-                        MeshCore::FacetIndex& FaceIndex);
+                        MeshCore::FacetIndex& FaceIndex,
+                        bool parallel = true);
 
 
 protected:
     void Do() override;
+    /// Thread-safe version of projectCurve(), log messages are returned in  messages
+    void projectCurve(const TopoDS_Edge& aEdge,
+                      std::vector<FaceSplitEdge>& vSplitEdges,
+                      bool parallel,
+                      std::vector<std::string>& messages);
 };
 
 
@@ -192,6 +202,22 @@ public:
     };
 
     explicit MeshProjection(const MeshKernel& rMesh);
+    ~MeshProjection();
+
+    /// Enables or disables the concurrent projection of edges and points (enabled by default)
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
+    /**
+     * The facet grid is rebuilt when the number of elements or the bounding box of the mesh
+     * changed. After any other modification of the mesh the grid must be invalidated.
+     */
+    void invalidateGrid();
 
     /**
      * @brief findSectionParameters
@@ -248,17 +274,29 @@ public:
     void splitMeshByShape(const TopoDS_Shape& aShape, float fMaxDist) const;
 
 protected:
-    void projectEdgeToEdge(const TopoDS_Edge& aCurve,
-                           float fMaxDist,
-                           const MeshCore::MeshFacetGrid& rGrid,
-                           std::vector<SplitEdge>& rSplitEdges) const;
+    /// Returns the number of mesh edges with more than one possible intersection point
+    std::size_t projectEdgeToEdge(const TopoDS_Edge& aCurve,
+                                  float fMaxDist,
+                                  const MeshCore::MeshFacetGrid& rGrid,
+                                  std::vector<SplitEdge>& rSplitEdges,
+                                  bool parallelSearch = false) const;
     bool findIntersection(const Edge&,
                           const Edge&,
                           const Base::Vector3f& dir,
                           Base::Vector3f& res) const;
+    void projectPolylinesParallel(const std::vector<std::vector<Base::Vector3f>>& polylines,
+                                  const Base::Vector3f& dir,
+                                  std::vector<PolyLine>& rPolyLines) const;
+    /// The facet grid is shared by all projections of this instance until the mesh changes
+    const MeshCore::MeshFacetGrid& getGrid() const;
 
 private:
     const MeshKernel& _rcMesh;
+    mutable std::unique_ptr<MeshCore::MeshFacetGrid> _grid;
+    mutable std::size_t _gridFacets {0};
+    mutable std::size_t _gridPoints {0};
+    mutable Base::BoundBox3f _gridBox;
+    bool parallel {true};
 };
 
 }  // namespace MeshPart
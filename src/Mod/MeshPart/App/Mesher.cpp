@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <unordered_map>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
@@ -127,11 +128,13 @@ namespace MeshPart
 class BrepMesh
 {
     bool segments;
+    bool parallel;
     std::vector<uint32_t> colors;
 
 public:
-    BrepMesh(bool s, const std::vector<uint32_t>& c)
+    BrepMesh(bool s, const std::vector<uint32_t>& c, bool p = false)
         : segments(s)
+        , parallel(p)
         , colors(c)
     {}
 
@@ -140,7 +143,9 @@ public:
         std::vector<Base::Vector3d> points;
         std::vector<Part::TopoShape::Facet> facets;
         Part::BRepMesh mesh;
+        mesh.setParallel(parallel);
         mesh.getFacesFromDomains(domains, points, facets);
+        std::vector<Part::BRepMesh::Segment> domainSegments = mesh.createSegments();
 
         MeshCore::MeshFacetArray faces;
         faces.reserve(facets.size());
@@ -172,10 +177,9 @@ public:
 
         // add a segment for the face
         if (createSegm || this->segments) {
-            auto segments = mesh.createSegments();
-            meshSegments.reserve(segments.size());
-            std::transform(segments.cbegin(),
-                           segments.cend(),
+            meshSegments.reserve(domainSegments.size());
+            std::transform(domainSegments.cbegin(),
+                           domainSegments.cend(),
                            std::back_inserter(meshSegments),
                            [](const Part::BRepMesh::Segment& segm) {
                                std::vector<MeshCore::FacetIndex> faces;
@@ -225,13 +229,17 @@ Mesh::MeshObject* Mesher::createStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+        // The edges are discretized first and shared by the faces which are
+        // then meshed concurrently, so the result stays watertight
+        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection, parallel);
     }
 
     std::vector<Part::TopoShape::Domain> domains;
-    Part::TopoShape(shape).getDomains(domains);
+    Part::BRepMesh mesh;
+    mesh.setParallel(parallel);
+    mesh.getDomains(shape, domains);
 
-    BrepMesh brepmesh(this->segments, this->colors);
+    BrepMesh brepmesh(this->segments, this->colors, this->parallel);
     return brepmesh.create(domains);
 }
 
@@ -441,7 +449,8 @@ Mesh::MeshObject* Mesher::createFrom(SMESH_Mesh* mesh) const
     faces.reserve(mesh->NbFaces());
 
     int index = 0;
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    std::unordered_map<const SMDS_MeshNode*, int> mapNodeIndex;
+    mapNodeIndex.reserve(mesh->NbNodes());
     for (; aNodeIter->more();) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
         MeshCore::MeshPoint p;
@@ -26,6 +26,7 @@
 #include <sstream>
 
 #include <Base/Stream.h>
+#include <Mod/MeshPart/MeshPartGlobal.h>
 
 #ifdef HAVE_SMESH
 #include <SMESH_Version.h>
@@ -42,7 +43,7 @@ class MeshObject;
 namespace MeshPart
 {
 
-class Mesher
+class MeshPartExport Mesher
 {
 public:
     enum Method
@@ -147,6 +148,15 @@ public:
     {
         colors = c;
     }
+    /// Meshes the faces and converts their triangulations concurrently (Standard method only, on by default)
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
     //@}
 
 #if defined(HAVE_NETGEN)
@@ -229,6 +239,7 @@ private:
     bool relative {false};
     bool regular {false};
     bool segments {false};
+    bool parallel {true};
 #if defined(HAVE_NETGEN)
     int fineness {5};
     double growthRate {0};
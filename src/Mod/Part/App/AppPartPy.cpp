@@ -597,6 +597,13 @@ public:
         add_varargs_method("clearShapeCache",&Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method("getShapeCacheStats",&Module::getShapeCacheStats,
+            "getShapeCacheStats(reset=False) -- Returns a dict with the statistics of the internal shape cache\n\n"
+            "* reset: if True, resets the hit, miss and eviction counters after reading them"
+        );
+        add_varargs_method("setShapeCacheSize",&Module::setShapeCacheSize,
+            "setShapeCacheSize(size) -- Sets the memory budget of the internal shape cache in bytes"
+        );
         add_keyword_method("getShape",&Module::getShape,
             "getShape(obj,subname=None,mat=None,needSubElement=False,transform=True,retType=0):\n"
             "Obtain the TopoShape of a given object with SubName reference\n\n"
@@ -2270,6 +2277,29 @@ private:
         return Py::Object();
     }
 
+    Py::Object getShapeCacheStats(const Py::Tuple &args) {
+        PyObject *reset = Py_False;
+        if (!PyArg_ParseTuple(args.ptr(),"|O!",&PyBool_Type,&reset))
+            throw Py::Exception();
+        auto stats = Part::Feature::getShapeCacheStats(Base::asBoolean(reset));
+        Py::Dict dict;
+        dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+        dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+        dict.setItem("Evictions", Py::Long(static_cast<unsigned long>(stats.evictions)));
+        dict.setItem("Entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+        dict.setItem("Memory", Py::Long(static_cast<unsigned long>(stats.memory)));
+        dict.setItem("MaxMemory", Py::Long(static_cast<unsigned long>(stats.maxMemory)));
+        return dict;
+    }
+
+    Py::Object setShapeCacheSize(const Py::Tuple &args) {
+        unsigned long long size;
+        if (!PyArg_ParseTuple(args.ptr(),"K",&size))
+            throw Py::Exception();
+        Part::Feature::setShapeCacheSize(static_cast<std::size_t>(size));
+        return Py::Object();
+    }
+
     Py::Object splitSubname(const Py::Tuple& args) {
         const char *subname;
         if (!PyArg_ParseTuple(args.ptr(), "s",&subname))
@@ -25,9 +25,19 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <limits>
+#include <set>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangle.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <gp_Pnt.hxx>
 #endif
 
 #include "BRepMesh.h"
+#include "Tools.h"
+#include "TopoShape.h"
 #include <Base/Tools.h>
 
 using namespace Part;
@@ -65,10 +75,96 @@ const double MeshVertex::epsilon = 10 * std::numeric_limits<double>::epsilon();
 
 }
 
+namespace {
+template<typename T, typename Compare>
+void parallelSort(std::vector<T>& items, Compare comp)
+{
+    const std::size_t minChunkSize = 65536;
+    std::size_t numThreads = std::max(OSD_Parallel::NbLogicalProcessors(), 1);
+    std::size_t numChunks = std::min(numThreads, items.size() / minChunkSize + 1);
+    std::vector<std::size_t> bounds(numChunks + 1);
+    for (std::size_t i = 0; i <= numChunks; i++) {
+        bounds[i] = items.size() * i / numChunks;
+    }
+
+    OSD_Parallel::For(0, static_cast<int>(numChunks), [&](int i) {
+        std::sort(items.begin() + bounds[i], items.begin() + bounds[i + 1], comp);
+    });
+
+    // merge neighboured chunks until only one is left
+    for (std::size_t step = 1; step < numChunks; step *= 2) {
+        std::vector<std::size_t> pairs;
+        for (std::size_t i = 0; i + step < numChunks; i += 2 * step) {
+            pairs.push_back(i);
+        }
+        OSD_Parallel::For(0, static_cast<int>(pairs.size()), [&](int k) {
+            std::size_t i = pairs[k];
+            std::size_t last = std::min(i + 2 * step, numChunks);
+            std::inplace_merge(items.begin() + bounds[i],
+                               items.begin() + bounds[i + step],
+                               items.begin() + bounds[last],
+                               comp);
+        });
+    }
+}
+
+void getDomain(const TopoDS_Face& face, Data::ComplexGeoData::Domain& domain)
+{
+    std::vector<gp_Pnt> points;
+    std::vector<Poly_Triangle> facets;
+    if (!Tools::getTriangulation(face, points, facets)) {
+        return;
+    }
+
+    domain.points.reserve(points.size());
+    for (const auto& it : points) {
+        domain.points.emplace_back(it.X(), it.Y(), it.Z());
+    }
+
+    domain.facets.reserve(facets.size());
+    for (const auto& it : facets) {
+        Standard_Integer N1, N2, N3;
+        it.Get(N1, N2, N3);
+
+        Data::ComplexGeoData::Facet tria;
+        tria.I1 = N1;
+        tria.I2 = N2;
+        tria.I3 = N3;
+        domain.facets.push_back(tria);
+    }
+}
+}
+
+void BRepMesh::getDomains(const TopoDS_Shape& shape, std::vector<Domain>& domains) const
+{
+    if (!parallel) {
+        TopoShape(shape).getDomains(domains);
+        return;
+    }
+
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+
+    // a face that cannot be meshed gets an empty domain so that the
+    // numbers of faces and domains match
+    std::size_t offset = domains.size();
+    domains.resize(offset + faces.size());
+    OSD_Parallel::For(0, static_cast<int>(faces.size()), [&](int i) {
+        getDomain(faces[i], domains[offset + i]);
+    });
+}
+
 void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
                                    std::vector<Base::Vector3d>& points,
                                    std::vector<Facet>& faces)
 {
+    if (parallel) {
+        getFacesFromDomainsParallel(domains, points, faces);
+        return;
+    }
+
     std::size_t numFaces = 0;
     for (const auto& it : domains) {
         numFaces += it.facets.size();
@@ -117,6 +213,125 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
     points.swap(meshPoints);
 }
 
+/*!
+ * Most points are shared by several facets and domains. Points with equal
+ * coordinates are found by sorting them concurrently. The remaining points
+ * are passed to the set in the order they are referenced first, so merging
+ * points within the tolerance works exactly as in serial mode.
+ */
+void BRepMesh::getFacesFromDomainsParallel(const std::vector<Domain>& domains,
+                                           std::vector<Base::Vector3d>& points,
+                                           std::vector<Facet>& faces)
+{
+    const std::size_t unused = std::numeric_limits<std::size_t>::max();
+
+    std::vector<std::size_t> pointOffset(domains.size() + 1, 0);
+    std::vector<std::size_t> facetOffset(domains.size() + 1, 0);
+    for (std::size_t i = 0; i < domains.size(); i++) {
+        pointOffset[i + 1] = pointOffset[i] + domains[i].points.size();
+        facetOffset[i + 1] = facetOffset[i] + domains[i].facets.size();
+    }
+
+    // Collect the points of all domains and the position where they are
+    // referenced first. Points that are not referenced are ignored.
+    std::vector<Base::Vector3d> allPoints(pointOffset.back());
+    std::vector<std::size_t> firstRef(pointOffset.back(), unused);
+    int numDomains = static_cast<int>(domains.size());
+    OSD_Parallel::For(0, numDomains, [&](int d) {
+        const Domain& domain = domains[d];
+        std::copy(domain.points.begin(), domain.points.end(), allPoints.begin() + pointOffset[d]);
+        std::size_t ref = 3 * facetOffset[d];
+        for (const Facet& df : domain.facets) {
+            for (uint32_t index : {df.I1, df.I2, df.I3}) {
+                std::size_t& first = firstRef[pointOffset[d] + index];
+                first = std::min(first, ref++);
+            }
+        }
+    });
+
+    std::vector<std::size_t> order;
+    order.reserve(allPoints.size());
+    for (std::size_t i = 0; i < allPoints.size(); i++) {
+        if (firstRef[i] != unused) {
+            order.push_back(i);
+        }
+    }
+
+    // equal points are sorted by their first reference
+    parallelSort(order, [&allPoints, &firstRef](std::size_t a, std::size_t b) {
+        const Base::Vector3d& p = allPoints[a];
+        const Base::Vector3d& q = allPoints[b];
+        if (p.x != q.x) {
+            return p.x < q.x;
+        }
+        if (p.y != q.y) {
+            return p.y < q.y;
+        }
+        if (p.z != q.z) {
+            return p.z < q.z;
+        }
+        return firstRef[a] < firstRef[b];
+    });
+
+    // points with exactly the same coordinates
+    auto isSame = [&allPoints](std::size_t a, std::size_t b) {
+        const Base::Vector3d& p = allPoints[a];
+        const Base::Vector3d& q = allPoints[b];
+        return p.x == q.x && p.y == q.y && p.z == q.z;
+    };
+
+    std::vector<std::size_t> unique(allPoints.size(), unused);
+    std::vector<std::size_t> uniquePoint;
+    for (std::size_t index : order) {
+        if (uniquePoint.empty() || !isSame(uniquePoint.back(), index)) {
+            uniquePoint.push_back(index);
+        }
+        unique[index] = uniquePoint.size() - 1;
+    }
+
+    parallelSort(uniquePoint, [&firstRef](std::size_t a, std::size_t b) {
+        return firstRef[a] < firstRef[b];
+    });
+
+    std::vector<std::size_t> pointIndex(uniquePoint.size());
+    std::set<MeshVertex> vertices;
+    for (std::size_t index : uniquePoint) {
+        MeshVertex vertex(allPoints[index]);
+        vertex.i = vertices.size();
+        auto it = vertices.insert(vertex);
+        pointIndex[unique[index]] = it.first->i;
+    }
+
+    // create the facets and skip degenerated ones
+    std::vector<std::vector<Facet>> domainFaces(domains.size());
+    OSD_Parallel::For(0, numDomains, [&](int d) {
+        std::vector<Facet>& result = domainFaces[d];
+        result.reserve(domains[d].facets.size());
+        for (const Facet& df : domains[d].facets) {
+            Facet face;
+            face.I1 = uint32_t(pointIndex[unique[pointOffset[d] + df.I1]]);
+            face.I2 = uint32_t(pointIndex[unique[pointOffset[d] + df.I2]]);
+            face.I3 = uint32_t(pointIndex[unique[pointOffset[d] + df.I3]]);
+            if (face.I1 != face.I2 && face.I2 != face.I3 && face.I3 != face.I1) {
+                result.push_back(face);
+            }
+        }
+    });
+
+    faces.reserve(faces.size() + facetOffset.back());
+    for (const auto& it : domainFaces) {
+        faces.insert(faces.end(), it.begin(), it.end());
+        domainSizes.push_back(it.size());
+    }
+
+    std::vector<Base::Vector3d> meshPoints;
+    meshPoints.resize(vertices.size());
+    for (const auto & vertex : vertices) {
+        meshPoints[vertex.i] = vertex.toPoint();
+    }
+    points.swap(meshPoints);
+}
+
 std::vector<BRepMesh::Segment> BRepMesh::createSegments() const
 {
     std::size_t numMeshFaces = 0;
@@ -27,6 +27,8 @@
 #include <Mod/Part/PartGlobal.h>
 #include <App/ComplexGeoData.h>
 
+class TopoDS_Shape;
+
 namespace Part {
 
 class PartExport BRepMesh
@@ -36,13 +38,38 @@ public:
     using Domain = Data::ComplexGeoData::Domain;
     using Segment = std::vector<std::size_t>;
 
+    /*!
+     * If enabled the triangulations of the faces are read and the points are
+     * merged concurrently. The result is the same as in serial mode.
+     * It's disabled by default.
+     */
+    void setParallel(bool on)
+    {
+        parallel = on;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
+
+    /*!
+     * Appends a domain for each face of \a shape. A face without a
+     * triangulation gets an empty domain.
+     */
+    void getDomains(const TopoDS_Shape& shape, std::vector<Domain>& domains) const;
     void getFacesFromDomains(const std::vector<Domain>& domains,
                              std::vector<Base::Vector3d>& points,
                              std::vector<Facet>& faces);
     std::vector<Segment> createSegments() const;
 
+private:
+    void getFacesFromDomainsParallel(const std::vector<Domain>& domains,
+                                     std::vector<Base::Vector3d>& points,
+                                     std::vector<Facet>& faces);
+
 private:
     std::vector<std::size_t> domainSizes;
+    bool parallel {false};
 };
 
 }
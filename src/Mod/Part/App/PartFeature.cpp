@@ -23,7 +23,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <atomic>
+# include <list>
+# include <mutex>
 # include <sstream>
+# include <unordered_set>
 # include <Bnd_Box.hxx>
 # include <BRepAdaptor_Curve.hxx>
 # include <BRepAlgoAPI_Fuse.hxx>
@@ -195,28 +199,209 @@ TopoDS_Shape Feature::getShape(const App::DocumentObject *obj, const char *subna
     return getTopoShape(obj,subname,needSubElement,pmat,powner,resolveLink,transform,true).getShape();
 }
 
-struct ShapeCache {
+/** Thread-safe LRU cache of the shapes resolved by getTopoShape().
+ *
+ * All entries of an object are kept in the same shard so that invalidating an
+ * object needs a single lock. The memory budget applies to all shards together,
+ * the least recently used entries of all shards are evicted first.
+ *
+ * A change of an object only stamps the object with a new generation. Whether
+ * an entry is outdated is checked when it is looked up, by comparing its
+ * generation with the stamps of the object and the objects it depends on.
+ */
+class ShapeCache {
+public:
+    bool getShape(const App::DocumentObject *obj, TopoShape &shape, const char *subname=nullptr) {
+        init();
+        if(!subname) subname = "";
+        auto &shard = getShard(obj);
+        bool found = false;
+        std::uint64_t entryGeneration = 0;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.objects.find(obj);
+            if(it!=shard.objects.end()) {
+                auto it2 = it->second.find(subname);
+                if(it2!=it->second.end() && !it2->second->shape.isNull()) {
+                    it2->second->tick = ++clock;
+                    shard.entries.splice(shard.entries.begin(), shard.entries, it2->second);
+                    shape = it2->second->shape;
+                    entryGeneration = it2->second->generation;
+                    found = true;
+                }
+            }
+        }
+        if(found && !changedSince(obj, entryGeneration)) {
+            ++hits;
+            return true;
+        }
+        if(found) {
+            clearObject(obj);
+            shape = TopoShape();
+        }
+        ++misses;
+        return false;
+    }
+
+    void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=nullptr) {
+        init();
+        if(!subname) subname = "";
+        std::size_t size = shape.getMemSize() + sizeof(Entry) + strlen(subname);
+        if(size > maxMemory)
+            return;
+        auto &shard = getShard(obj);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto &subnames = shard.objects[obj];
+            auto it = subnames.find(subname);
+            if(it!=subnames.end())
+                eraseEntry(shard, it->second);
+            shard.entries.push_front(
+                Entry{obj, obj->getDocument(), subname, shape, size, ++clock, generation.load()});
+            subnames[subname] = shard.entries.begin();
+            memory += size;
+            ++numEntries;
+        }
+        evict();
+    }
 
-    std::unordered_map<const App::Document*,
-        std::map<std::pair<const App::DocumentObject*, std::string> ,TopoShape> > cache;
+    void clear() {
+        for(auto &shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            while(!shard.entries.empty())
+                eraseEntry(shard, std::prev(shard.entries.end()));
+        }
+    }
+
+    void setMaxMemory(std::size_t size) {
+        maxMemory = size;
+        evict();
+    }
+
+    Feature::ShapeCacheStats getStats() {
+        init();
+        Feature::ShapeCacheStats stats;
+        stats.hits = hits;
+        stats.misses = misses;
+        stats.evictions = evictions;
+        stats.entries = numEntries;
+        stats.memory = memory;
+        stats.maxMemory = maxMemory;
+        return stats;
+    }
+
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+        evictions = 0;
+    }
+
+private:
+    struct Entry {
+        const App::DocumentObject *obj;
+        const App::Document *doc;
+        std::string subname;
+        TopoShape shape;
+        std::size_t size;
+        std::uint64_t tick;
+        // value of ShapeCache::generation when the entry was added
+        std::uint64_t generation;
+    };
+    using EntryList = std::list<Entry>;
+
+    struct Shard {
+        std::mutex mutex;
+        // most recently used entry first
+        EntryList entries;
+        std::unordered_map<const App::DocumentObject*,
+            std::unordered_map<std::string, EntryList::iterator> > objects;
+    };
+    static constexpr std::size_t NumShards = 16;
 
-    bool inited = false;
     void init() {
-        if(inited)
+        std::call_once(inited, [this]() {
+            auto hGrp = App::GetApplication().GetParameterGroupByPath(
+                    "User parameter:BaseApp/Preferences/Mod/Part/General");
+            // budget in MB
+            maxMemory = static_cast<std::size_t>(hGrp->GetUnsigned("ShapeCacheSize", 256)) << 20;
+            //NOLINTBEGIN
+            App::GetApplication().signalDeleteDocument.connect(
+                    std::bind(&ShapeCache::slotDeleteDocument, this, sp::_1));
+            App::GetApplication().signalDeletedObject.connect(
+                    std::bind(&ShapeCache::slotDeletedObject, this, sp::_1));
+            App::GetApplication().signalChangedObject.connect(
+                    std::bind(&ShapeCache::slotChanged, this, sp::_1,sp::_2));
+            //NOLINTEND
+        });
+    }
+
+    Shard &getShard(const App::DocumentObject *obj) {
+        auto hash = reinterpret_cast<std::uintptr_t>(obj);
+        hash ^= hash >> 16;
+        return shards[(hash >> 4) % NumShards];
+    }
+
+    void eraseEntry(Shard &shard, EntryList::iterator it) {
+        auto jt = shard.objects.find(it->obj);
+        if(jt!=shard.objects.end()) {
+            jt->second.erase(it->subname);
+            if(jt->second.empty())
+                shard.objects.erase(jt);
+        }
+        memory -= it->size;
+        --numEntries;
+        shard.entries.erase(it);
+    }
+
+    void evict() {
+        while(memory > maxMemory) {
+            // find the shard with the least recently used entry
+            Shard *oldest = nullptr;
+            std::uint64_t tick = 0;
+            for(auto &shard : shards) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                if(!shard.entries.empty() && (!oldest || shard.entries.back().tick < tick)) {
+                    oldest = &shard;
+                    tick = shard.entries.back().tick;
+                }
+            }
+            if(!oldest)
+                return;
+            std::lock_guard<std::mutex> lock(oldest->mutex);
+            if(!oldest->entries.empty()) {
+                eraseEntry(*oldest, std::prev(oldest->entries.end()));
+                ++evictions;
+            }
+        }
+    }
+
+    void clearObject(const App::DocumentObject *obj) {
+        auto &shard = getShard(obj);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.objects.find(obj);
+        if(it==shard.objects.end())
             return;
-        inited = true;
-        //NOLINTBEGIN
-        App::GetApplication().signalDeleteDocument.connect(
-                std::bind(&ShapeCache::slotDeleteDocument, this, sp::_1));
-        App::GetApplication().signalDeletedObject.connect(
-                std::bind(&ShapeCache::slotClear, this, sp::_1));
-        App::GetApplication().signalChangedObject.connect(
-                std::bind(&ShapeCache::slotChanged, this, sp::_1,sp::_2));
-        //NOLINTEND
+        std::vector<EntryList::iterator> entries;
+        for(auto &v : it->second)
+            entries.push_back(v.second);
+        for(auto &entry : entries)
+            eraseEntry(shard, entry);
     }
 
     void slotDeleteDocument(const App::Document &doc) {
-        cache.erase(&doc);
+        {
+            std::lock_guard<std::mutex> lock(stampMutex);
+            for(auto obj : doc.getObjects())
+                stamps.erase(obj);
+        }
+        for(auto &shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for(auto it=shard.entries.begin(); it!=shard.entries.end();) {
+                auto entry = it++;
+                if(entry->doc == &doc)
+                    eraseEntry(shard, entry);
+            }
+        }
     }
 
     void slotChanged(const App::DocumentObject &obj, const App::Property &prop) {
@@ -226,43 +411,76 @@ struct ShapeCache {
         if(strcmp(propName,"Shape")==0
                 || strcmp(propName,"Group")==0
                 || strstr(propName,"Touched"))
-            slotClear(obj);
+            stamp(obj);
     }
 
-    void slotClear(const App::DocumentObject &obj) {
-        auto it = cache.find(obj.getDocument());
-        if(it==cache.end())
-            return;
-        auto &map = it->second;
-        for(auto it2=map.lower_bound(std::make_pair(&obj,std::string()));
-                it2!=map.end() && it2->first.first==&obj;)
-        {
-            it2 = map.erase(it2);
-        }
+    void slotDeletedObject(const App::DocumentObject &obj) {
+        clearObject(&obj);
+        std::lock_guard<std::mutex> lock(stampMutex);
+        stamps.erase(&obj);
+        // The dependents no longer reach obj when they are looked up
+        for(auto parent : obj.getInList())
+            stamps[parent] = ++generation;
     }
 
-    bool getShape(const App::DocumentObject *obj, TopoShape &shape, const char *subname=nullptr) {
-        init();
-        auto &entry = cache[obj->getDocument()];
-        if(!subname) subname = "";
-        auto it = entry.find(std::make_pair(obj,std::string(subname)));
-        if(it!=entry.end()) {
-            shape = it->second;
-            return !shape.isNull();
+    void stamp(const App::DocumentObject &obj) {
+        std::lock_guard<std::mutex> lock(stampMutex);
+        stamps[&obj] = ++generation;
+    }
+
+    /// Checks if obj or any object it depends on has changed after the given generation
+    bool changedSince(const App::DocumentObject *obj, std::uint64_t since) {
+        if(generation == since)
+            return false;
+        // The cached shapes of links and groups are made of the shapes of the
+        // objects they depend on, so check those too.
+        std::lock_guard<std::mutex> lock(stampMutex);
+        std::vector<const App::DocumentObject*> pending {obj};
+        std::unordered_set<const App::DocumentObject*> visited {obj};
+        while(!pending.empty()) {
+            auto current = pending.back();
+            pending.pop_back();
+            auto it = stamps.find(current);
+            if(it!=stamps.end() && it->second > since)
+                return true;
+            for(auto child : current->getOutList()) {
+                if(visited.insert(child).second)
+                    pending.push_back(child);
+            }
         }
         return false;
     }
 
-    void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=nullptr) {
-        init();
-        if(!subname) subname = "";
-        cache[obj->getDocument()][std::make_pair(obj,std::string(subname))] = shape;
-    }
+    std::array<Shard, NumShards> shards;
+    std::once_flag inited;
+    std::atomic<std::size_t> memory {0};
+    std::atomic<std::size_t> maxMemory {0};
+    std::atomic<std::size_t> numEntries {0};
+    std::atomic<std::uint64_t> clock {0};
+    std::mutex stampMutex;
+    // generation of the last change of an object
+    std::unordered_map<const App::DocumentObject*, std::uint64_t> stamps;
+    std::atomic<std::uint64_t> generation {0};
+    std::atomic<std::size_t> hits {0};
+    std::atomic<std::size_t> misses {0};
+    std::atomic<std::size_t> evictions {0};
 };
 static ShapeCache _ShapeCache;
 
 void Feature::clearShapeCache() {
-    _ShapeCache.cache.clear();
+    _ShapeCache.clear();
+}
+
+Feature::ShapeCacheStats Feature::getShapeCacheStats(bool reset) {
+    auto stats = _ShapeCache.getStats();
+    if(reset)
+        _ShapeCache.resetStats();
+    return stats;
+}
+
+void Feature::setShapeCacheSize(std::size_t size) {
+    _ShapeCache.getStats(); // make sure the cache is initialized
+    _ShapeCache.setMaxMemory(size);
 }
 
 static TopoShape _getTopoShape(const App::DocumentObject *obj, const char *subname,
@@ -299,7 +517,10 @@ static TopoShape _getTopoShape(const App::DocumentObject *obj, const char *subna
     Base::Matrix4D linkMat;
     {
         Base::PyGILStateLocker lock;
-        owner = obj->getSubObject(subname,shape.isNull()?&pyobj:nullptr,&mat,false);
+        if(shape.isNull())
+            owner = obj->getSubObject(subname,&pyobj,&mat,false);
+        else
+            owner = obj->getSubObjectCached(subname,&mat,false);
         if(!owner)
             return shape;
         linked = owner->getLinkedObject(true,&linkMat,false);
@@ -485,7 +706,7 @@ App::DocumentObject *Feature::getShapeOwner(const App::DocumentObject *obj, cons
 {
     if(!obj)
         return nullptr;
-    auto owner = obj->getSubObject(subname);
+    auto owner = obj->getSubObjectCached(subname);
     if(owner) {
         auto linked = owner->getLinkedObject(true);
         if(linked)
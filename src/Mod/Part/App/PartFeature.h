@@ -103,6 +103,23 @@ public:
 
     static void clearShapeCache();
 
+    /// Statistics of the shape cache used by getTopoShape()
+    struct ShapeCacheStats
+    {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+        std::size_t evictions = 0;
+        std::size_t entries = 0;
+        /// estimated memory used by the cached shapes in bytes
+        std::size_t memory = 0;
+        /// memory budget in bytes
+        std::size_t maxMemory = 0;
+    };
+    /// Returns the statistics of the shape cache, optionally resets the counters
+    static ShapeCacheStats getShapeCacheStats(bool reset = false);
+    /// Sets the memory budget of the shape cache in bytes
+    static void setShapeCacheSize(std::size_t size);
+
     static App::DocumentObject *getShapeOwner(const App::DocumentObject *obj, const char *subname=nullptr);
 
     static bool hasShapeOwner(const App::DocumentObject *obj, const char *subname=nullptr) {
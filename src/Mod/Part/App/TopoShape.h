@@ -1394,6 +1394,13 @@ public:
                                        const Mapper &mapper,
                                        const std::vector<TopoShape> &sources,
                                        const char *op=nullptr);
+
+    /** Enable or disable the concurrent collection of the names from the shape
+     *  history in makeShapeWithElementMap(). The generated names are the same
+     *  in both modes. It is enabled by default.
+     */
+    static void setParallelElementMapping(bool on);
+    static bool isParallelElementMapping();
     /**
      * When given a single shape to create a compound, two results are possible: either to simply
      * return the shape as given, or to force it to be placed in a Compound.
@@ -25,6 +25,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <atomic>
 #include <cmath>
 
 #include <BRepAdaptor_Curve.hxx>
@@ -87,9 +88,7 @@
 
 #endif
 
-#if OCC_VERSION_HEX >= 0x070500
 #include <OSD_Parallel.hxx>
-#endif
 
 #include "modelRefine.h"
 #include "CrossSection.h"
@@ -1193,6 +1192,213 @@ void checkForParallelOrCoplanar(const TopoDS_Shape& newShape,
     }
 }
 
+namespace
+{
+
+std::atomic<bool> parallelElementMapping {true};
+
+// The history of a sub-shape of an input shape as reported by the mapper
+struct ElementHistory
+{
+    ShapeInfo* info {};
+    int index {};
+    long tag {};
+    TopoDS_Shape element;
+    NameKey key;
+    Data::ElementIDRefs sids;
+    std::vector<TopoDS_Shape> modified;
+    std::vector<TopoDS_Shape> generated;
+};
+
+// A name source for a sub-shape of the new shape
+struct NameCandidate
+{
+    Data::IndexedName element;
+    NameKey key;
+    NameInfo info;
+};
+
+// Log messages are collected and printed by the calling thread
+struct NameMessage
+{
+    bool error {};
+    std::string text;
+};
+
+struct ElementNames
+{
+    std::vector<NameCandidate> candidates;
+    std::vector<NameMessage> messages;
+};
+
+// Find the sub-shapes of the new shape that are modified or generated by the
+// source element of the given history
+ElementNames collectElementNames(const ElementHistory& history,
+                                 const std::array<ShapeInfo*, TopAbs_SHAPE>& infoMap,
+                                 const char* op)
+{
+    ElementNames res;
+    const auto& info = *history.info;
+    const int i = history.index;
+    const bool logEnabled = FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG);
+    auto addMessage = [&res](bool error, const std::ostringstream& str) {
+        res.messages.push_back(NameMessage {error, str.str()});
+    };
+
+    NameKey key = history.key;
+    key.tag = history.tag;
+
+    // Find all new objects that are a modification of the old object
+    int newShapeCounter = 0;
+    for (auto& newShape : history.modified) {
+        ++newShapeCounter;
+        if (newShape.ShapeType() >= TopAbs_SHAPE) {
+            std::ostringstream str;
+            str << "unknown modified shape type " << newShape.ShapeType() << " from "
+                << info.shapetype << i;
+            addMessage(true, str);
+            continue;
+        }
+        auto& newInfo = *infoMap.at(newShape.ShapeType());
+        if (newInfo.type != newShape.ShapeType()) {
+            if (logEnabled) {
+                // TODO: it seems modified shape may report higher
+                // level shape type just like generated shape below.
+                // Maybe we shall do the same for name construction.
+                std::ostringstream str;
+                str << "modified shape type " << TopoShape::shapeName(newShape.ShapeType())
+                    << " mismatch with " << info.shapetype << i;
+                addMessage(false, str);
+            }
+            continue;
+        }
+        int newShapeIndex = newInfo.find(newShape);
+        if (newShapeIndex == 0) {
+            // This warning occurs in makeElementRevolve. It generates
+            // some shape from a vertex that never made into the
+            // final shape. There may be incomingShape cases there.
+            if (logEnabled) {
+                std::ostringstream str;
+                str << "Cannot find " << op << " modified " << newInfo.shapetype << " from "
+                    << info.shapetype << i;
+                addMessage(false, str);
+            }
+            continue;
+        }
+
+        NameCandidate candidate;
+        candidate.element = Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
+        candidate.key = key;
+        candidate.info.sids = history.sids;
+        candidate.info.index = newShapeCounter;
+        candidate.info.shapetype = info.shapetype;
+        res.candidates.push_back(std::move(candidate));
+    }
+
+    int checkParallel = -1;
+    gp_Pln pln;
+
+    // Find all new objects that were generated from an old object
+    // (e.g. a face generated from an edge)
+    newShapeCounter = 0;
+    for (auto& newShape : history.generated) {
+        if (newShape.ShapeType() >= TopAbs_SHAPE) {
+            std::ostringstream str;
+            str << "unknown generated shape type " << newShape.ShapeType() << " from "
+                << info.shapetype << i;
+            addMessage(true, str);
+            continue;
+        }
+
+        int parallelFace = -1;
+        int coplanarFace = -1;
+        auto& newInfo = *infoMap.at(newShape.ShapeType());
+        std::vector<TopoDS_Shape> newShapes;
+        int shapeOffset = 0;
+        if (newInfo.type == newShape.ShapeType()) {
+            newShapes.push_back(newShape);
+        }
+        else {
+            // It is possible for the maker to report generating a
+            // higher level shape, such as shell or solid. For
+            // example, when extruding, OCC will report the
+            // extruding face generating the entire solid. However,
+            // it will also report the edges of the extruding face
+            // generating the side faces. In this case, too much
+            // information is bad for us. We don't want the name of
+            // the side face (and its edges) to be coupled with
+            // incomingShape (unrelated) edges in the extruding face.
+            //
+            // shapeOffset below is used to make sure the higher
+            // level mapped names comes late after sorting. We'll
+            // ignore those names if there are more precise mapping
+            // available.
+            shapeOffset = 3;
+
+            if (info.type == TopAbs_FACE && checkParallel < 0) {
+                if (!TopoShape(history.element).findPlane(pln)) {
+                    checkParallel = 0;
+                }
+                else {
+                    checkParallel = 1;
+                }
+            }
+            checkForParallelOrCoplanar(newShape,
+                                       newInfo,
+                                       newShapes,
+                                       pln,
+                                       parallelFace,
+                                       coplanarFace,
+                                       checkParallel);
+        }
+        key.shapetype += shapeOffset;
+        for (auto& workingShape : newShapes) {
+            ++newShapeCounter;
+            int workingShapeIndex = newInfo.find(workingShape);
+            if (workingShapeIndex == 0) {
+                if (logEnabled) {
+                    std::ostringstream str;
+                    str << "Cannot find " << op << " generated " << newInfo.shapetype
+                        << " from " << info.shapetype << i;
+                    addMessage(false, str);
+                }
+                continue;
+            }
+
+            NameCandidate candidate;
+            candidate.element =
+                Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
+            candidate.key = key;
+            candidate.info.sids = history.sids;
+            if (newShapeCounter == parallelFace) {
+                candidate.info.index = std::numeric_limits<int>::min();
+            }
+            else if (newShapeCounter == coplanarFace) {
+                candidate.info.index = std::numeric_limits<int>::min() + 1;
+            }
+            else {
+                candidate.info.index = -newShapeCounter;
+            }
+            candidate.info.shapetype = info.shapetype;
+            res.candidates.push_back(std::move(candidate));
+        }
+        key.shapetype -= shapeOffset;
+    }
+    return res;
+}
+
+}  // namespace
+
+void TopoShape::setParallelElementMapping(bool on)
+{
+    parallelElementMapping = on;
+}
+
+bool TopoShape::isParallelElementMapping()
+{
+    return parallelElementMapping;
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const Mapper& mapper,
@@ -1252,7 +1458,9 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     std::map<Data::IndexedName, std::map<NameKey, NameInfo>> newNames;
 
     // First, collect names from other shapes that generates or modifies the
-    // new shape
+    // new shape. The mapper is not thread safe, so its history is queried
+    // here one sub-shape at a time.
+    std::vector<ElementHistory> histories;
     for (auto& pinfo : infos) {  // Walk Vertexes, then Edges, then Faces
         auto& info = *pinfo;
         for (const auto& incomingShape : shapes) {
@@ -1265,155 +1473,54 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
             }
 
             for (int i = 1; i <= otherMap.count(); i++) {
-                const auto& otherElement = otherMap.find(incomingShape._Shape, i);
-                // Find all new objects that are a modification of the old object
-                Data::ElementIDRefs sids;
-                NameKey key(
+                ElementHistory history;
+                history.info = &info;
+                history.index = i;
+                history.tag = incomingShape.Tag;
+                history.element = otherMap.find(incomingShape._Shape, i);
+                history.key = NameKey(
                     info.type,
                     incomingShape.getMappedName(Data::IndexedName::fromConst(info.shapetype, i),
                                                 true,
-                                                &sids));
-
-                int newShapeCounter = 0;
-                for (auto& newShape : mapper.modified(otherElement)) {
-                    ++newShapeCounter;
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown modified shape type " << newShape.ShapeType() << " from "
-                                                              << info.shapetype << i);
-                        continue;
-                    }
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    if (newInfo.type != newShape.ShapeType()) {
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // TODO: it seems modified shape may report higher
-                            // level shape type just like generated shape below.
-                            // Maybe we shall do the same for name construction.
-                            // NOLINTNEXTLINE
-                            FC_WARN("modified shape type " << shapeName(newShape.ShapeType())
-                                                           << " mismatch with " << info.shapetype
-                                                           << i);
-                        }
-                        continue;
-                    }
-                    int newShapeIndex = newInfo.find(newShape);
-                    if (newShapeIndex == 0) {
-                        // This warning occurs in makeElementRevolve. It generates
-                        // some shape from a vertex that never made into the
-                        // final shape. There may be incomingShape cases there.
-                        if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                            // NOLINTNEXTLINE
-                            FC_WARN("Cannot find " << op << " modified " << newInfo.shapetype
-                                                   << " from " << info.shapetype << i);
-                        }
-                        continue;
-                    }
-
-                    Data::IndexedName element =
-                        Data::IndexedName::fromConst(newInfo.shapetype, newShapeIndex);
-                    if (getMappedName(element)) {
-                        continue;
-                    }
-
-                    key.tag = incomingShape.Tag;
-                    auto& name_info = newNames[element][key];
-                    name_info.sids = sids;
-                    name_info.index = newShapeCounter;
-                    name_info.shapetype = info.shapetype;
-                }
-
-                int checkParallel = -1;
-                gp_Pln pln;
-
-                // Find all new objects that were generated from an old object
-                // (e.g. a face generated from an edge)
-                newShapeCounter = 0;
-                for (auto& newShape : mapper.generated(otherElement)) {
-                    if (newShape.ShapeType() >= TopAbs_SHAPE) {
-                        // NOLINTNEXTLINE
-                        FC_ERR("unknown generated shape type " << newShape.ShapeType() << " from "
-                                                               << info.shapetype << i);
-                        continue;
-                    }
-
-                    int parallelFace = -1;
-                    int coplanarFace = -1;
-                    auto& newInfo = *infoMap.at(newShape.ShapeType());
-                    std::vector<TopoDS_Shape> newShapes;
-                    int shapeOffset = 0;
-                    if (newInfo.type == newShape.ShapeType()) {
-                        newShapes.push_back(newShape);
-                    }
-                    else {
-                        // It is possible for the maker to report generating a
-                        // higher level shape, such as shell or solid. For
-                        // example, when extruding, OCC will report the
-                        // extruding face generating the entire solid. However,
-                        // it will also report the edges of the extruding face
-                        // generating the side faces. In this case, too much
-                        // information is bad for us. We don't want the name of
-                        // the side face (and its edges) to be coupled with
-                        // incomingShape (unrelated) edges in the extruding face.
-                        //
-                        // shapeOffset below is used to make sure the higher
-                        // level mapped names comes late after sorting. We'll
-                        // ignore those names if there are more precise mapping
-                        // available.
-                        shapeOffset = 3;
-
-                        if (info.type == TopAbs_FACE && checkParallel < 0) {
-                            if (!TopoShape(otherElement).findPlane(pln)) {
-                                checkParallel = 0;
-                            }
-                            else {
-                                checkParallel = 1;
-                            }
-                        }
-                        checkForParallelOrCoplanar(newShape,
-                                                   newInfo,
-                                                   newShapes,
-                                                   pln,
-                                                   parallelFace,
-                                                   coplanarFace,
-                                                   checkParallel);
-                    }
-                    key.shapetype += shapeOffset;
-                    for (auto& workingShape : newShapes) {
-                        ++newShapeCounter;
-                        int workingShapeIndex = newInfo.find(workingShape);
-                        if (workingShapeIndex == 0) {
-                            if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
-                                // NOLINTNEXTLINE
-                                FC_WARN("Cannot find " << op << " generated " << newInfo.shapetype
-                                                       << " from " << info.shapetype << i);
-                            }
-                            continue;
-                        }
-
-                        Data::IndexedName element =
-                            Data::IndexedName::fromConst(newInfo.shapetype, workingShapeIndex);
-                        auto mapped = getMappedName(element);
-                        if (mapped) {
-                            continue;
-                        }
+                                                &history.sids));
+                history.modified = mapper.modified(history.element);
+                history.generated = mapper.generated(history.element);
+                histories.push_back(std::move(history));
+            }
+        }
+    }
 
-                        key.tag = incomingShape.Tag;
-                        auto& name_info = newNames[element][key];
-                        name_info.sids = sids;
-                        if (newShapeCounter == parallelFace) {
-                            name_info.index = std::numeric_limits<int>::min();
-                        }
-                        else if (newShapeCounter == coplanarFace) {
-                            name_info.index = std::numeric_limits<int>::min() + 1;
-                        }
-                        else {
-                            name_info.index = -newShapeCounter;
-                        }
-                        name_info.shapetype = info.shapetype;
-                    }
-                    key.shapetype -= shapeOffset;
-                }
+    // Then find the new sub-shapes. This is independent for each source
+    // element and is done concurrently if possible. Looking up shapes with a
+    // non-identity location modifies the shape cache, so that case stays
+    // serial.
+    std::vector<ElementNames> elementNames(histories.size());
+    const std::size_t minParallelCount = 256;
+    bool parallel = isParallelElementMapping() && histories.size() >= minParallelCount
+        && _Shape.Location().IsIdentity();
+    OSD_Parallel::For(
+        0,
+        static_cast<int>(histories.size()),
+        [&](int index) {
+            elementNames[index] = collectElementNames(histories[index], infoMap, op);
+        },
+        !parallel);
+
+    // Insert the names in the same order as the serial walk to get stable names
+    for (const auto& names : elementNames) {
+        for (const auto& message : names.messages) {
+            if (message.error) {
+                FC_ERR(message.text);  // NOLINT
+            }
+            else {
+                FC_WARN(message.text);  // NOLINT
+            }
+        }
+        for (const auto& candidate : names.candidates) {
+            if (getMappedName(candidate.element)) {
+                continue;
             }
+            newNames[candidate.element][candidate.key] = candidate.info;
         }
     }
 
@@ -36,6 +36,7 @@
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/elements/SoLazyElement.h>
@@ -46,6 +47,7 @@
 # include <Inventor/elements/SoGLVBOElement.h>
 # include <Inventor/errors/SoDebugError.h>
 # include <Inventor/details/SoFaceDetail.h>
+# include <Inventor/details/SoPointDetail.h>
 # include <Inventor/misc/SoState.h>
 # include <Inventor/misc/SoContextHandler.h>
 # include <Inventor/elements/SoCacheElement.h>
@@ -335,6 +337,7 @@ void SoBrepFaceSet::doAction(SoAction* action)
             v.second.updateVbo = true;
             v.second.vboLoaded = false;
         }
+        updateBVH = true;
     }
 
     inherited::doAction(action);
@@ -1868,6 +1871,163 @@ void SoBrepFaceSet::renderShape(SoGLRenderAction * action,
     glEnd();
 }
 
+/*!
+  Rebuilds the picking hierarchy if the coordinates or the indices have changed.
+  Returns false if the face set cannot be handled by the hierarchy, i.e. if it
+  contains other primitives than triangles.
+ */
+bool SoBrepFaceSet::updatePickHierarchy(const SoCoordinateElement * coords)
+{
+    int numindices = this->coordIndex.getNum();
+    if (!updateBVH && bvhCoordId == coords->getNodeId() && bvhNumIndices == numindices)
+        return !bvh.isEmpty();
+
+    bvh.clear();
+    partOffsets.clear();
+    bvhCoordId = coords->getNodeId();
+    bvhNumIndices = numindices;
+    updateBVH = false;
+
+    // Each triangle must be terminated with -1 except the last one
+    const int32_t * cindices = this->coordIndex.getValues(0);
+    int numtriangles = (numindices + 1) / 4;
+    int numcoords = coords->getNum();
+    if (numtriangles == 0 || (4 * numtriangles != numindices && 4 * numtriangles - 1 != numindices))
+        return false;
+    for (int i = 0; i < numtriangles; i++) {
+        const int32_t * tri = cindices + 4 * i;
+        if (tri[0] < 0 || tri[1] < 0 || tri[2] < 0)
+            return false;
+        if (tri[0] >= numcoords || tri[1] >= numcoords || tri[2] >= numcoords)
+            return false;
+        if (4 * i + 3 < numindices && tri[3] >= 0)
+            return false;
+    }
+
+    const int32_t * pindices = this->partIndex.getValues(0);
+    int numparts = this->partIndex.getNum();
+    int32_t offset = 0;
+    partOffsets.reserve(numparts);
+    for (int i = 0; i < numparts; i++) {
+        offset += std::max<int32_t>(pindices[i], 0);
+        partOffsets.push_back(offset);
+    }
+
+    bvh.build(numtriangles, [coords, cindices](std::size_t index, SbVec3f& v1, SbVec3f& v2, SbVec3f& v3) {
+        const int32_t * tri = cindices + 4 * index;
+        v1 = coords->get3(tri[0]);
+        v2 = coords->get3(tri[1]);
+        v3 = coords->get3(tri[2]);
+    });
+
+    return true;
+}
+
+int SoBrepFaceSet::getPartIndexOfTriangle(int triangle) const
+{
+    auto it = std::upper_bound(partOffsets.begin(), partOffsets.end(), triangle);
+    if (it == partOffsets.end())
+        return -1;
+    return static_cast<int>(it - partOffsets.begin());
+}
+
+/*!
+  Instead of generating all primitives only the triangles of the leaves of the
+  picking hierarchy that are hit by the ray are tested.
+ */
+void SoBrepFaceSet::rayPick(SoRayPickAction * action)
+{
+    if (!this->shouldRayPick(action))
+        return;
+
+    SoState * state = action->getState();
+    if (this->vertexProperty.getValue() || this->coordIndex.getNum() < 3) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    const SoCoordinateElement * coords = SoCoordinateElement::getInstance(state);
+    if (!updatePickHierarchy(coords)) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    this->computeObjectSpaceRay(action);
+
+    const int32_t * cindices = this->coordIndex.getValues(0);
+    Binding mbind = this->findMaterialBinding(state);
+    Binding nbind = this->findNormalBinding(state);
+    const int32_t * mindices = this->materialIndex.getNum() > 0 && this->materialIndex[0] >= 0
+        ? this->materialIndex.getValues(0) : nullptr;
+    const int32_t * nindices = this->normalIndex.getNum() > 0 && this->normalIndex[0] >= 0
+        ? this->normalIndex.getValues(0) : nullptr;
+    // index of the binding for a triangle, the part (i.e. face) it belongs to
+    // and its vertex 'i', an unset index field falls back to the coordinate index
+    auto bindingIndex = [cindices](Binding binding, const int32_t * indices,
+                                   int triangle, int part, int i) -> int32_t {
+        switch (binding) {
+        case PER_PART:
+            return part;
+        case PER_PART_INDEXED:
+            return indices ? indices[part] : part;
+        case PER_FACE:
+            return triangle;
+        case PER_FACE_INDEXED:
+            return indices ? indices[triangle] : triangle;
+        case PER_VERTEX:
+            return 3 * triangle + i;
+        case PER_VERTEX_INDEXED:
+            return indices ? indices[4 * triangle + i] : cindices[4 * triangle + i];
+        default:
+            return 0;
+        }
+    };
+    auto testBox = [action](const SbBox3f& box) {
+        return action->intersect(box, TRUE) ? Gui::Inventor::TriangleBVH::Overlap::Partial
+                                             : Gui::Inventor::TriangleBVH::Overlap::Outside;
+    };
+    auto testTriangle = [&](std::size_t index, bool) {
+        const int32_t * tri = cindices + 4 * index;
+        const SbVec3f & v1 = coords->get3(tri[0]);
+        const SbVec3f & v2 = coords->get3(tri[1]);
+        const SbVec3f & v3 = coords->get3(tri[2]);
+
+        SbVec3f isect;
+        SbVec3f barycentric;
+        SbBool front;
+        if (!action->intersect(v1, v2, v3, isect, barycentric, front) ||
+            !action->isBetweenPlanes(isect))
+            return;
+
+        SoPickedPoint * pp = action->addIntersection(isect);
+        if (!pp)
+            return;
+
+        SbVec3f normal = (v2 - v1).cross(v3 - v1);
+        normal.normalize();
+        pp->setObjectNormal(normal);
+
+        auto detail = new SoFaceDetail();
+        detail->setFaceIndex(static_cast<int32_t>(index));
+        int triangle = static_cast<int>(index);
+        int part = getPartIndexOfTriangle(triangle);
+        detail->setPartIndex(part);
+        part = std::max(part, 0);
+        detail->setNumPoints(3);
+        SoPointDetail pointDetail;
+        for (int i = 0; i < 3; i++) {
+            pointDetail.setCoordinateIndex(tri[i]);
+            pointDetail.setNormalIndex(bindingIndex(nbind, nindices, triangle, part, i));
+            pointDetail.setMaterialIndex(bindingIndex(mbind, mindices, triangle, part, i));
+            detail->setPoint(i, &pointDetail);
+        }
+        pp->setMaterialIndex(bindingIndex(mbind, mindices, triangle, part, 0));
+        pp->setDetail(detail, this);
+    };
+
+    bvh.traverse(testBox, testTriangle);
+}
+
 SoDetail * SoBrepFaceSet::createTriangleDetail(SoRayPickAction * action,
                                                const SoPrimitiveVertex * v1,
                                                const SoPrimitiveVertex * v2,
@@ -29,9 +29,11 @@
 #include <memory>
 #include <vector>
 #include <Gui/SoFCSelectionContext.h>
+#include <Gui/Inventor/TriangleBVH.h>
 #include <Mod/Part/PartGlobal.h>
 
 
+class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
@@ -95,6 +97,7 @@ protected:
         SoPickedPoint * pp) override;
     void generatePrimitives(SoAction * action) override;
     void getBoundingBox(SoGetBoundingBoxAction * action) override;
+    void rayPick(SoRayPickAction * action) override;
 
 private:
     enum Binding {
@@ -134,6 +137,9 @@ private:
 
     bool overrideMaterialBinding(SoGLRenderAction *action, SelContextPtr ctx, SelContextPtr ctx2);
 
+    bool updatePickHierarchy(const SoCoordinateElement * coords);
+    int getPartIndexOfTriangle(int triangle) const;
+
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
     void renderColoredArray(SoMaterialBundle *const materials);
@@ -154,6 +160,13 @@ private:
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
+
+    // Hierarchy for picking, rebuilt on demand
+    Gui::Inventor::TriangleBVH bvh;
+    std::vector<int32_t> partOffsets;
+    uint32_t bvhCoordId = 0;
+    int bvhNumIndices = 0;
+    bool updateBVH = true;
 };
 
 } // namespace PartGui
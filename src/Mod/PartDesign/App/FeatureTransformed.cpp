@@ -31,6 +31,11 @@
 # include <BRepBuilderAPI_Transform.hxx>
 # include <Precision.hxx>
 # include <TopExp_Explorer.hxx>
+# include <TopLoc_Location.hxx>
+# include <algorithm>
+# include <cmath>
+# include <future>
+# include <thread>
 #endif
 
 #include <App/Application.h>
@@ -67,6 +72,79 @@ Transformed::Transformed()
     Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetUserParameter()
         .GetGroup("BaseApp")->GetGroup("Preferences")->GetGroup("Mod/PartDesign");
     this->Refine.setValue(hGrp->GetBool("RefineModel", false));
+
+    ADD_PROPERTY_TYPE(FastPattern,(false),"Part Design",(App::PropertyType)(App::Prop_None),
+                      "Let the copies share the geometry of the originals and use a single "
+                      "parallel boolean operation for all copies");
+    this->FastPattern.setValue(hGrp->GetBool("FastPatternMode", false));
+}
+
+namespace {
+
+bool isRigidTransformation(const gp_Trsf& trsf)
+{
+    return !trsf.IsNegative() && std::fabs(trsf.ScaleFactor() - 1.0) < Precision::Confusion();
+}
+
+TopoDS_Shape makeTransformedCopy(const TopoDS_Shape& shape, const gp_Trsf& trsf)
+{
+    // Make an explicit copy of the shape because the "true" parameter to BRepBuilderAPI_Transform
+    // seems to be pretty broken
+    BRepBuilderAPI_Copy copy(shape);
+
+    BRepBuilderAPI_Transform mkTrf(copy.Shape(), trsf, false); // No need to copy, now
+    if (!mkTrf.IsDone()) {
+        throw Base::CADKernelError(QT_TRANSLATE_NOOP("Exception", "Transformation failed"));
+    }
+    return mkTrf.Shape();
+}
+
+/**
+ * Creates the instances of \a shape for all transformations. Rigid transformations are
+ * only applied as location so that all instances share the geometry of \a shape. For all
+ * other transformations a deep copy is needed which is done concurrently.
+ */
+std::vector<TopoDS_Shape> makeSharedInstances(const TopoDS_Shape& shape,
+                                              std::vector<gp_Trsf>::const_iterator begin,
+                                              std::vector<gp_Trsf>::const_iterator end)
+{
+    std::vector<TopoDS_Shape> shapes(static_cast<std::size_t>(std::distance(begin, end)));
+    std::vector<std::size_t> copies;
+    std::size_t index = 0;
+    for (auto it = begin; it != end; ++it, ++index) {
+        if (isRigidTransformation(*it)) {
+            shapes[index] = shape.Moved(TopLoc_Location(*it));
+        }
+        else {
+            copies.push_back(index);
+        }
+    }
+
+    if (copies.empty()) {
+        return shapes;
+    }
+
+    std::size_t numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, copies.size());
+    auto worker = [&](std::size_t first) {
+        for (std::size_t i = first; i < copies.size(); i += numThreads) {
+            std::size_t pos = copies[i];
+            shapes[pos] = makeTransformedCopy(shape, *(begin + pos));
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker, i));
+    }
+    // re-throws the first exception of a worker
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    return shapes;
+}
+
 }
 
 void Transformed::positionBySupport()
@@ -211,6 +289,8 @@ App::DocumentObjectExecReturn *Transformed::execute()
     supportShape.setTransform(Base::Matrix4D());
     TopoDS_Shape support = supportShape.getShape();
 
+    bool fastPattern = FastPattern.getValue();
+
     auto getTransformedCompShape = [&](const auto& origShape)
     {
         TopTools_ListOfShape shapeTools;
@@ -221,20 +301,13 @@ App::DocumentObjectExecReturn *Transformed::execute()
         // First transformation is skipped since it should not be part of the toolShape.
         ++transformIter;
 
-        for (; transformIter != transformations.end(); ++transformIter) {
-            // Make an explicit copy of the shape because the "true" parameter to BRepBuilderAPI_Transform
-            // seems to be pretty broken
-            BRepBuilderAPI_Copy copy(origShape);
-
-            TopoDS_Shape shape = copy.Shape();
-
-            BRepBuilderAPI_Transform mkTrf(shape, *transformIter, false); // No need to copy, now
-            if (!mkTrf.IsDone()) {
-                throw Base::CADKernelError(QT_TRANSLATE_NOOP("Exception", "Transformation failed"));
+        if (fastPattern) {
+            shapes = makeSharedInstances(origShape, transformIter, transformations.cend());
+        }
+        else {
+            for (; transformIter != transformations.end(); ++transformIter) {
+                shapes.emplace_back(makeTransformedCopy(origShape, *transformIter));
             }
-            shape = mkTrf.Shape();
-
-            shapes.emplace_back(shape);
         }
 
         for (const auto& shape : shapes)
@@ -243,11 +316,82 @@ App::DocumentObjectExecReturn *Transformed::execute()
         return shapeTools;
     };
 
+    // In fast pattern mode the tools of consecutive originals of the same type are
+    // collected and handled by a single parallel boolean operation.
+    std::vector<std::pair<App::DocumentObject*, TopTools_ListOfShape>> pendingTools;
+    bool pendingFuse = true;
+    auto applyBoolean = [&](TopoDS_Shape& current, const TopTools_ListOfShape& shapeTools, bool fuse) {
+        TopTools_ListOfShape shapeArguments;
+        shapeArguments.Append(current);
+        std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool;
+        if (fuse)
+            mkBool = std::make_unique<BRepAlgoAPI_Fuse>();
+        else
+            mkBool = std::make_unique<BRepAlgoAPI_Cut>();
+        mkBool->SetArguments(shapeArguments);
+        mkBool->SetTools(shapeTools);
+        if (fastPattern) {
+            mkBool->SetRunParallel(Standard_True);
+            // the tools share their geometry with the originals which must not be modified
+            mkBool->SetNonDestructive(Standard_True);
+        }
+        mkBool->Build();
+        if (!mkBool->IsDone())
+            return false;
+        current = mkBool->Shape();
+        return true;
+    };
+    // Applies the collected tools and returns the original that makes the boolean
+    // operation fail, if any
+    auto applyPendingTools = [&](TopoDS_Shape& current) -> App::DocumentObject* {
+        if (pendingTools.empty())
+            return nullptr;
+        TopTools_ListOfShape shapeTools;
+        for (auto& pending : pendingTools)
+            shapeTools.Append(pending.second);
+        App::DocumentObject* failed = nullptr;
+        if (!applyBoolean(current, shapeTools, pendingFuse)) {
+            // apply the originals one by one to find the one causing the failure
+            for (const auto& pending : pendingTools) {
+                if (!applyBoolean(current, pending.second, pendingFuse)) {
+                    failed = pending.first;
+                    break;
+                }
+            }
+        }
+        pendingTools.clear();
+        return failed;
+    };
+    auto addTools = [&](App::DocumentObject* original, TopoDS_Shape& current,
+                        TopTools_ListOfShape& shapeTools, bool fuse) -> App::DocumentObject* {
+        if (shapeTools.IsEmpty())
+            return nullptr;
+        if (!fastPattern)
+            return applyBoolean(current, shapeTools, fuse) ? nullptr : original;
+        if (pendingFuse != fuse) {
+            if (auto failed = applyPendingTools(current))
+                return failed;
+        }
+        pendingFuse = fuse;
+        pendingTools.emplace_back(original, shapeTools);
+        return nullptr;
+    };
+    auto booleanFailed = [fastPattern](App::DocumentObject* original) {
+        // several originals are applied at once in fast pattern mode, so name the failing one
+        if (fastPattern) {
+            Base::Console().Error("Transformed: Boolean operation failed for original '%s'\n",
+                                  original->getNameInDocument());
+        }
+        return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"));
+    };
+
     // NOTE: It would be possible to build a compound from all original addShapes/subShapes and then
     // transform the compounds as a whole. But we choose to apply the transformations to each
     // Original separately. This way it is easier to discover what feature causes a fuse/cut
     // to fail. The downside is that performance suffers when there are many originals. But it seems
-    // safe to assume that in most cases there are few originals and many transformations
+    // safe to assume that in most cases there are few originals and many transformations.
+    // In fast pattern mode the tools of several originals are applied at once. If that fails they
+    // are applied one by one again to find the original that causes the failure.
     for (auto original : originals)
     {
         // Extract the original shape and determine whether to cut or to fuse
@@ -270,40 +414,28 @@ App::DocumentObjectExecReturn *Transformed::execute()
         }
 
         TopoDS_Shape current = support;
-        if (!fuseShape.isNull()) {
-            TopTools_ListOfShape shapeArguments;
-            shapeArguments.Append(current);
-            TopTools_ListOfShape shapeTools = getTransformedCompShape(fuseShape.getShape());
-            if (!shapeTools.IsEmpty()) {
-                std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool(new BRepAlgoAPI_Fuse());
-                mkBool->SetArguments(shapeArguments);
-                mkBool->SetTools(shapeTools);
-                mkBool->Build();
-                if (!mkBool->IsDone()) {
-                    return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"));
-                }
-                current = mkBool->Shape();
+        try {
+            if (!fuseShape.isNull()) {
+                TopTools_ListOfShape shapeTools = getTransformedCompShape(fuseShape.getShape());
+                if (auto failed = addTools(original, current, shapeTools, true))
+                    return booleanFailed(failed);
             }
-        }
-        if (!cutShape.isNull()) {
-            TopTools_ListOfShape shapeArguments;
-            shapeArguments.Append(current);
-            TopTools_ListOfShape shapeTools = getTransformedCompShape(cutShape.getShape());
-            if (!shapeTools.IsEmpty()) {
-                std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkBool(new BRepAlgoAPI_Cut());
-                mkBool->SetArguments(shapeArguments);
-                mkBool->SetTools(shapeTools);
-                mkBool->Build();
-                if (!mkBool->IsDone()) {
-                    return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Boolean operation failed"));
-                }
-                current = mkBool->Shape();
+            if (!cutShape.isNull()) {
+                TopTools_ListOfShape shapeTools = getTransformedCompShape(cutShape.getShape());
+                if (auto failed = addTools(original, current, shapeTools, false))
+                    return booleanFailed(failed);
             }
         }
+        catch (Base::Exception& e) {
+            return new App::DocumentObjectExecReturn(e.what());
+        }
 
         support = current; // Use result of this operation for fuse/cut of next original
     }
 
+    if (auto failed = applyPendingTools(support))
+        return booleanFailed(failed);
+
     support = refineShapeIfActive(support);
 
     int solidCount = countSolids(support);
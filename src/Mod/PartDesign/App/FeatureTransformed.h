@@ -51,6 +51,13 @@ public:
 
     App::PropertyBool Refine;
 
+    /** Fast pattern mode
+      * The transformed copies share the geometry of the originals and all copies
+      * of consecutive originals of the same type are fused or cut with a single
+      * parallel boolean operation
+      */
+    App::PropertyBool FastPattern;
+
     /**
      * Returns the BaseFeature property's object(if any) otherwise return first original,
      *         which serves as "Support" for old style workflows
@@ -19,6 +19,8 @@
 #*                                                                         *
 #***************************************************************************
 
+import math
+import time
 import unittest
 
 import FreeCAD
@@ -139,6 +141,40 @@ class TestLinearPattern(unittest.TestCase):
         self.Doc.recompute()
         self.assertAlmostEqual(self.LinearPattern.Shape.Volume, 1e4)
 
+    def testFastPatternLinearPattern(self):
+        self.Body = self.Doc.addObject('PartDesign::Body','Body')
+        self.Box = self.Doc.addObject('PartDesign::AdditiveBox','Box')
+        self.Body.addObject(self.Box)
+        self.Box.Length=1010.00
+        self.Box.Width=10.00
+        self.Box.Height=10.00
+        self.Cylinder = self.Doc.addObject('PartDesign::SubtractiveCylinder','Cylinder')
+        self.Body.addObject(self.Cylinder)
+        self.Cylinder.Radius = 2.0
+        self.Cylinder.Height = 10.0
+        self.Cylinder.Placement.Base = FreeCAD.Vector(5, 5, 0)
+        self.Doc.recompute()
+        self.LinearPattern = self.Doc.addObject("PartDesign::LinearPattern","LinearPattern")
+        self.LinearPattern.Originals = [self.Cylinder]
+        self.LinearPattern.Direction = (self.Doc.X_Axis,[""])
+        self.LinearPattern.Length = 1000.0
+        self.LinearPattern.Occurrences = 101
+        self.LinearPattern.Refine = False
+        self.Body.addObject(self.LinearPattern)
+        volume = 1010.0 * 100.0 - 101 * math.pi * 4.0 * 10.0
+
+        timings = []
+        for fast in (False, True):
+            self.LinearPattern.FastPattern = fast
+            self.LinearPattern.touch()
+            start = time.perf_counter()
+            self.Doc.recompute()
+            timings.append(time.perf_counter() - start)
+            self.assertAlmostEqual(self.LinearPattern.Shape.Volume, volume, places=3)
+            self.assertEqual(len(self.LinearPattern.Shape.Solids), 1)
+        FreeCAD.Console.PrintLog("LinearPattern with 101 holes: standard {:.3f}s, fast {:.3f}s\n"
+                                 .format(*timings))
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartDesignTestLinearPattern")
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cmath>
+#endif
+
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+PointsKDTree::PointsKDTree(const std::vector<Base::Vector3f>& points)
+{
+    tree.Reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& p = points[i];
+        if (!std::isnan(p.x) && !std::isnan(p.y) && !std::isnan(p.z)) {
+            tree.Add(p, i);
+        }
+    }
+    tree.Build();
+}
+
+void PointsKDTree::FindNearest(const Base::Vector3f& p,
+                               std::size_t k,
+                               std::vector<std::size_t>& indices,
+                               std::vector<float>& distances) const
+{
+    std::vector<MeshCore::FlatKDTree<std::size_t>::Candidate> nearest;
+    nearest.reserve(k);
+    tree.KNearest(p, k, nearest);
+
+    indices.clear();
+    distances.clear();
+    for (const auto& it : nearest) {
+        indices.push_back(tree.GetNode(it.node).i);
+        distances.push_back(std::sqrt(it.dist2));
+    }
+}
+
+void PointsKDTree::FindInRadius(const Base::Vector3f& p,
+                                float radius,
+                                std::vector<std::size_t>& indices) const
+{
+    tree.Range(p, radius, true, indices);
+}
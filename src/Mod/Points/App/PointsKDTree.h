@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_KDTREE_H
+#define POINTS_KDTREE_H
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include <Mod/Mesh/App/Core/FlatKDTree.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+
+/** The PointsKDTree class is a static k-d tree for neighbourhood queries on
+ * point clouds.
+ *
+ * It uses the same header-only tree as MeshCore::MeshKDTree, built once in the
+ * constructor. The queries don't modify the tree and may be run concurrently
+ * from several threads.
+ */
+class PointsExport PointsKDTree
+{
+public:
+    /// Builds the tree, points with NaN coordinates are skipped
+    explicit PointsKDTree(const std::vector<Base::Vector3f>& points);
+
+    PointsKDTree(const PointsKDTree&) = delete;
+    PointsKDTree(PointsKDTree&&) = delete;
+    PointsKDTree& operator=(const PointsKDTree&) = delete;
+    PointsKDTree& operator=(PointsKDTree&&) = delete;
+    ~PointsKDTree() = default;
+
+    /// Returns the number of valid points
+    std::size_t size() const
+    {
+        return tree.Size();
+    }
+    /** Searches for the \a k nearest points to \a p, sorted by ascending distance.
+     * If \a p is a point of the tree it is part of the result.
+     */
+    void FindNearest(const Base::Vector3f& p,
+                     std::size_t k,
+                     std::vector<std::size_t>& indices,
+                     std::vector<float>& distances) const;
+    /// Appends the indices of all points with a distance of at most \a radius to \a p
+    void FindInRadius(const Base::Vector3f& p,
+                      float radius,
+                      std::vector<std::size_t>& indices) const;
+
+private:
+    MeshCore::FlatKDTree<std::size_t> tree;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_KDTREE_H
@@ -22,15 +22,18 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <array>
 #include <boost/math/special_functions/fpclassify.hpp>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "Processing.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 // clang-format off
 #include "PointsPy.h"
@@ -244,6 +247,106 @@ PyObject* PointsPy::fromValid(PyObject* args)
     }
 }
 
+PyObject* PointsPy::estimateNormals(PyObject* args, PyObject* kwds)
+{
+    int ksearch = 10;
+    double radius = 0.0;
+    PyObject* view = nullptr;
+    static const std::array<const char*, 4> keywords {"KSearch", "SearchRadius", "ViewPoint", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwds,
+                                             "|idO!",
+                                             keywords,
+                                             &ksearch,
+                                             &radius,
+                                             &(Base::VectorPy::Type),
+                                             &view)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        NormalEstimation estimate(*getPointKernelPtr());
+        estimate.setKSearch(ksearch);
+        estimate.setSearchRadius(radius);
+        if (view) {
+            estimate.setViewPoint(*static_cast<Base::VectorPy*>(view)->getVectorPtr());
+        }
+
+        std::vector<Base::Vector3f> normals;
+        estimate.perform(normals);
+
+        Py::List list;
+        for (const auto& it : normals) {
+            list.append(Py::Vector(it));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::removeOutliers(PyObject* args, PyObject* kwds)
+{
+    int ksearch = 50;
+    double stddev = 1.0;
+    static const std::array<const char*, 3> keywords {"KSearch", "StdDevMul", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwds, "|id", keywords, &ksearch, &stddev)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* points = getPointKernelPtr();
+        OutlierRemoval filter(*points);
+        filter.setKSearch(ksearch);
+        filter.setStdDevMultiplier(stddev);
+
+        std::vector<unsigned long> inliers;
+        filter.perform(inliers);
+
+        std::unique_ptr<PointKernel> pts(new PointKernel());
+        pts->setTransform(points->getTransform());
+        pts->reserve(inliers.size());
+        const std::vector<PointKernel::value_type>& basic = points->getBasicPoints();
+        std::vector<PointKernel::value_type>& values = pts->getBasicPoints();
+        for (auto index : inliers) {
+            values.push_back(basic[index]);
+        }
+
+        return new PointsPy(pts.release());
+    }
+    PY_CATCH;
+}
+
+PyObject* PointsPy::downsample(PyObject* args, PyObject* kwds)
+{
+    double dimX = 0.0;
+    double dimY = 0.0;
+    double dimZ = 0.0;
+    static const std::array<const char*, 4> keywords {"DimX", "DimY", "DimZ", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args, kwds, "d|dd", keywords, &dimX, &dimY, &dimZ)) {
+        return nullptr;
+    }
+
+    if (dimY == 0.0) {
+        dimY = dimX;
+    }
+    if (dimZ == 0.0) {
+        dimZ = dimX;
+    }
+
+    PY_TRY
+    {
+        VoxelGridFilter filter(*getPointKernelPtr());
+        filter.setLeafSize(dimX, dimY, dimZ);
+
+        std::unique_ptr<PointKernel> pts(new PointKernel());
+        filter.perform(*pts);
+        return new PointsPy(pts.release());
+    }
+    PY_CATCH;
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
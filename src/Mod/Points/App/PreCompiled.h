@@ -35,6 +35,7 @@
 #ifdef _PreComp_
 
 // standard
+#include <cstdint>
 #include <cstdio>
 
 // STL
@@ -44,6 +45,7 @@
 #include <memory>
 #include <set>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 // boost
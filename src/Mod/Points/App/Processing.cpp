@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#endif
+
+#include <Eigen/Eigenvalues>
+
+#include <Base/BoundBox.h>
+#include <Base/Converter.h>
+#include <Base/Exception.h>
+#include <Base/Matrix.h>
+
+#include <Mod/Mesh/App/Core/Functional.h>
+
+#include "PointsKDTree.h"
+#include "Processing.h"
+
+
+using namespace Points;
+
+namespace
+{
+bool isValid(const Base::Vector3f& p)
+{
+    return !std::isnan(p.x) && !std::isnan(p.y) && !std::isnan(p.z);
+}
+
+// The rotational part of the kernel's transformation
+Base::Matrix4D getRotation(const Base::Matrix4D& mat)
+{
+    Base::Matrix4D rot;
+    for (unsigned short i = 0; i < 3; i++) {
+        double s = std::sqrt(mat[i][0] * mat[i][0] + mat[i][1] * mat[i][1] + mat[i][2] * mat[i][2]);
+        for (unsigned short j = 0; j < 3; j++) {
+            rot[i][j] = s > 0.0 ? mat[i][j] / s : 0.0;
+        }
+    }
+    return rot;
+}
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+NormalEstimation::NormalEstimation(const PointKernel& pts)
+    : myPoints(pts)
+{}
+
+void NormalEstimation::perform(std::vector<Base::Vector3f>& normals) const
+{
+    if (kSearch <= 0 && searchRadius <= 0.0) {
+        throw Base::ValueError("Either the number of neighbours or the search radius must be set");
+    }
+
+    // The neighbourhood doesn't depend on the placement, so the local points are used
+    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
+    PointsKDTree tree(points);
+    Base::Matrix4D rot = getRotation(myPoints.getTransform());
+    auto radius = static_cast<float>(searchRadius);
+
+    normals.assign(points.size(), Base::Vector3f());
+    MeshCore::parallel_for(points.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<std::size_t> indices;
+        std::vector<float> distances;
+        for (std::size_t i = first; i < last; i++) {
+            if (!isValid(points[i])) {
+                continue;
+            }
+
+            indices.clear();
+            if (kSearch > 0) {
+                tree.FindNearest(points[i], kSearch, indices, distances);
+                if (radius > 0.0F) {
+                    auto it = std::upper_bound(distances.begin(), distances.end(), radius);
+                    indices.resize(std::distance(distances.begin(), it));
+                }
+            }
+            else {
+                tree.FindInRadius(points[i], radius, indices);
+            }
+            if (indices.size() < 3) {
+                continue;
+            }
+
+            Eigen::Vector3d center(Eigen::Vector3d::Zero());
+            for (auto index : indices) {
+                const Base::Vector3f& p = points[index];
+                center += Eigen::Vector3d(p.x, p.y, p.z);
+            }
+            center /= static_cast<double>(indices.size());
+
+            Eigen::Matrix3d cov(Eigen::Matrix3d::Zero());
+            for (auto index : indices) {
+                const Base::Vector3f& p = points[index];
+                Eigen::Vector3d d = Eigen::Vector3d(p.x, p.y, p.z) - center;
+                cov += d * d.transpose();
+            }
+
+            // The eigenvalues are sorted in increasing order
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+            solver.computeDirect(cov);
+            Eigen::Vector3d vec = solver.eigenvectors().col(0);
+
+            Base::Vector3d normal = rot * Base::Vector3d(vec.x(), vec.y(), vec.z());
+            Base::Vector3d toView = viewPoint - myPoints.getPoint(static_cast<int>(i));
+            if (normal * toView < 0.0) {
+                normal = -normal;
+            }
+            normal.Normalize();
+            normals[i] = Base::convertTo<Base::Vector3f>(normal);
+        }
+    });
+}
+
+// ----------------------------------------------------------------------------
+
+OutlierRemoval::OutlierRemoval(const PointKernel& pts)
+    : myPoints(pts)
+{}
+
+void OutlierRemoval::perform(std::vector<unsigned long>& inliers) const
+{
+    if (kSearch <= 0) {
+        throw Base::ValueError("The number of neighbours must be positive");
+    }
+
+    const std::vector<Base::Vector3f>& points = myPoints.getBasicPoints();
+    PointsKDTree tree(points);
+
+    // Mean distance of each point to its neighbours, -1 for invalid points
+    std::vector<double> meanDist(points.size(), -1.0);
+    MeshCore::parallel_for(points.size(), [&](std::size_t first, std::size_t last) {
+        std::vector<std::size_t> indices;
+        std::vector<float> distances;
+        for (std::size_t i = first; i < last; i++) {
+            if (!isValid(points[i])) {
+                continue;
+            }
+
+            // The first neighbour is the point itself
+            tree.FindNearest(points[i], kSearch + 1, indices, distances);
+            double sum = 0.0;
+            for (std::size_t j = 1; j < distances.size(); j++) {
+                sum += distances[j];
+            }
+            meanDist[i] = distances.size() > 1 ? sum / double(distances.size() - 1) : 0.0;
+        }
+    });
+
+    double sum = 0.0;
+    double sumSq = 0.0;
+    std::size_t count = 0;
+    for (double dist : meanDist) {
+        if (dist >= 0.0) {
+            sum += dist;
+            sumSq += dist * dist;
+            count++;
+        }
+    }
+
+    inliers.clear();
+    if (count == 0) {
+        return;
+    }
+
+    double mean = sum / double(count);
+    double variance = count > 1 ? (sumSq - sum * mean) / double(count - 1) : 0.0;
+    double threshold = mean + stdDevMul * std::sqrt(std::max(variance, 0.0));
+
+    inliers.reserve(count);
+    for (std::size_t i = 0; i < meanDist.size(); i++) {
+        if (meanDist[i] >= 0.0 && meanDist[i] <= threshold) {
+            inliers.push_back(static_cast<unsigned long>(i));
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+VoxelGridFilter::VoxelGridFilter(const PointKernel& pts)
+    : myPoints(pts)
+{}
+
+void VoxelGridFilter::perform(PointKernel& points) const
+{
+    if (leafSize.x <= 0.0 || leafSize.y <= 0.0 || leafSize.z <= 0.0) {
+        throw Base::ValueError("The leaf size must be positive");
+    }
+
+    const std::vector<Base::Vector3f>& basic = myPoints.getBasicPoints();
+    std::vector<Base::Vector3d> global(basic.size());
+    MeshCore::parallel_for(basic.size(), [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            global[i] = myPoints.getPoint(static_cast<int>(i));
+        }
+    });
+
+    Base::BoundBox3d bbox;
+    for (const auto& it : global) {
+        if (!std::isnan(it.x) && !std::isnan(it.y) && !std::isnan(it.z)) {
+            bbox.Add(it);
+        }
+    }
+
+    std::vector<Base::Vector3d> centroids;
+    if (bbox.IsValid()) {
+        auto nx = static_cast<std::uint64_t>(std::floor(bbox.LengthX() / leafSize.x)) + 1;
+        auto ny = static_cast<std::uint64_t>(std::floor(bbox.LengthY() / leafSize.y)) + 1;
+        auto nz = static_cast<std::uint64_t>(std::floor(bbox.LengthZ() / leafSize.z)) + 1;
+        if (double(nx) * double(ny) * double(nz) > double(UINT64_MAX / 2)) {
+            throw Base::ValueError("The leaf size is too small for the size of the point cloud");
+        }
+
+        // Sorting the points by their cell makes the points of a cell consecutive
+        std::vector<std::pair<std::uint64_t, std::size_t>> cells;
+        cells.reserve(global.size());
+        for (std::size_t i = 0; i < global.size(); i++) {
+            const Base::Vector3d& p = global[i];
+            if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z)) {
+                continue;
+            }
+            auto ix = std::min(static_cast<std::uint64_t>((p.x - bbox.MinX) / leafSize.x), nx - 1);
+            auto iy = std::min(static_cast<std::uint64_t>((p.y - bbox.MinY) / leafSize.y), ny - 1);
+            auto iz = std::min(static_cast<std::uint64_t>((p.z - bbox.MinZ) / leafSize.z), nz - 1);
+            cells.emplace_back(ix + nx * (iy + ny * iz), i);
+        }
+        std::sort(cells.begin(), cells.end());
+
+        for (std::size_t i = 0; i < cells.size();) {
+            Base::Vector3d center;
+            std::size_t j = i;
+            for (; j < cells.size() && cells[j].first == cells[i].first; j++) {
+                center += global[cells[j].second];
+            }
+            centroids.push_back(center / double(j - i));
+            i = j;
+        }
+    }
+
+    points.setTransform(Base::Matrix4D());
+    points.resize(0);
+    points.reserve(centroids.size());
+    for (const auto& it : centroids) {
+        points.push_back(it);
+    }
+}
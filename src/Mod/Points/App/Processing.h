@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_PROCESSING_H
+#define POINTS_PROCESSING_H
+
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "Points.h"
+
+
+namespace Points
+{
+
+/** Estimates the normals of a point cloud.
+ * The normal of a point is the direction of least variance of its neighbourhood,
+ * oriented towards a view point. Points with less than three neighbours get a
+ * null vector.
+ */
+class PointsExport NormalEstimation
+{
+public:
+    explicit NormalEstimation(const PointKernel&);
+
+    /** Sets the number of nearest neighbours used for each point. */
+    void setKSearch(int k)
+    {
+        kSearch = k;
+    }
+    /** Sets the radius of the neighbourhood. If both the radius and the number
+     * of neighbours are set then the k nearest neighbours inside the radius are
+     * used.
+     */
+    void setSearchRadius(double radius)
+    {
+        searchRadius = radius;
+    }
+    /** The normals are flipped to point towards this point. */
+    void setViewPoint(const Base::Vector3d& point)
+    {
+        viewPoint = point;
+    }
+    /** Computes the normals in the global coordinate system. */
+    void perform(std::vector<Base::Vector3f>& normals) const;
+
+private:
+    const PointKernel& myPoints;
+    int kSearch {10};
+    double searchRadius {0.0};
+    Base::Vector3d viewPoint;
+};
+
+/** Removes sparse outliers of a point cloud.
+ * For each point the mean distance to its k nearest neighbours is computed.
+ * Points whose mean distance is larger than the mean of all these distances
+ * plus a multiple of their standard deviation are outliers.
+ */
+class PointsExport OutlierRemoval
+{
+public:
+    explicit OutlierRemoval(const PointKernel&);
+
+    /** Sets the number of nearest neighbours used for each point. */
+    void setKSearch(int k)
+    {
+        kSearch = k;
+    }
+    /** Sets the multiple of the standard deviation of the mean distances. */
+    void setStdDevMultiplier(double mul)
+    {
+        stdDevMul = mul;
+    }
+    /** Returns the sorted indices of the points that are kept. */
+    void perform(std::vector<unsigned long>& inliers) const;
+
+private:
+    const PointKernel& myPoints;
+    int kSearch {50};
+    double stdDevMul {1.0};
+};
+
+/** Down-samples a point cloud.
+ * The points of each cell of a regular, axis aligned grid are replaced by
+ * their centroid.
+ */
+class PointsExport VoxelGridFilter
+{
+public:
+    explicit VoxelGridFilter(const PointKernel&);
+
+    /** Sets the dimensions of a grid cell. */
+    void setLeafSize(double dx, double dy, double dz)
+    {
+        leafSize.Set(dx, dy, dz);
+    }
+    /** Computes the centroids in the global coordinate system. */
+    void perform(PointKernel& points) const;
+
+private:
+    const PointKernel& myPoints;
+    Base::Vector3d leafSize;
+};
+
+}  // namespace Points
+
+#endif  // POINTS_PROCESSING_H
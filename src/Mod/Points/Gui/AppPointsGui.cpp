@@ -29,6 +29,7 @@
 #include <Gui/Language/Translator.h>
 #include <Mod/Points/App/PropertyPointKernel.h>
 
+#include "SoFCPointCloud.h"
 #include "ViewProvider.h"
 #include "Workbench.h"
 
@@ -87,6 +88,8 @@ PyMOD_INIT_FUNC(PointsGui)
     // instantiating the commands
     CreatePointsCommands();
 
+    PointsGui::SoFCPointCloud::initClass();
+
     // clang-format off
     PointsGui::ViewProviderPoints       ::init();
     PointsGui::ViewProviderScattered    ::init();
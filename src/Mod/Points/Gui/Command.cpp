@@ -45,6 +45,7 @@
 #include <Gui/WaitCursor.h>
 
 #include "../App/PointsFeature.h"
+#include "../App/Processing.h"
 #include "../App/Properties.h"
 #include "../App/Structured.h"
 #include "../App/Tools.h"
@@ -507,6 +508,207 @@ bool CmdPointsStructure::isActive()
     return getSelection().countObjectsOfType(Points::Feature::getClassTypeId()) == 1;
 }
 
+DEF_STD_CMD_A(CmdPointsEstimateNormals)
+
+CmdPointsEstimateNormals::CmdPointsEstimateNormals()
+    : Command("Points_EstimateNormals")
+{
+    sAppModule = "Points";
+    sGroup = QT_TR_NOOP("Points");
+    sMenuText = QT_TR_NOOP("Estimate normals...");
+    sToolTipText = QT_TR_NOOP("Estimate the normals of the selected point clouds");
+    sWhatsThis = "Points_EstimateNormals";
+    sStatusTip = QT_TR_NOOP("Estimate the normals of the selected point clouds");
+}
+
+void CmdPointsEstimateNormals::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+
+    bool ok;
+    int ksearch = QInputDialog::getInt(Gui::getMainWindow(),
+                                       QObject::tr("Normals"),
+                                       QObject::tr("Number of neighbours:"),
+                                       10,
+                                       3,
+                                       1000,
+                                       1,
+                                       &ok,
+                                       Qt::MSWindowsFixedSizeDialogHint);
+    if (!ok) {
+        return;
+    }
+
+    Gui::WaitCursor wc;
+    openCommand(QT_TRANSLATE_NOOP("Command", "Estimate normals"));
+    std::vector<Points::Feature*> points = getSelection().getObjectsOfType<Points::Feature>();
+    try {
+        for (auto it : points) {
+            Points::NormalEstimation estimate(it->Points.getValue());
+            estimate.setKSearch(ksearch);
+            std::vector<Base::Vector3f> normals;
+            estimate.perform(normals);
+
+            auto prop = dynamic_cast<Points::PropertyNormalList*>(it->getPropertyByName("Normal"));
+            if (!prop) {
+                prop = static_cast<Points::PropertyNormalList*>(
+                    it->addDynamicProperty("Points::PropertyNormalList", "Normal"));
+            }
+            prop->setValues(normals);
+
+            if (auto vp = dynamic_cast<Gui::ViewProviderDocumentObject*>(
+                    Gui::Application::Instance->getViewProvider(it))) {
+                vp->DisplayMode.setValue("Shaded");
+            }
+        }
+        commitCommand();
+    }
+    catch (const Base::Exception& e) {
+        abortCommand();
+        e.ReportException();
+    }
+    updateActive();
+}
+
+bool CmdPointsEstimateNormals::isActive()
+{
+    return getSelection().countObjectsOfType(Points::Feature::getClassTypeId()) > 0;
+}
+
+DEF_STD_CMD_A(CmdPointsRemoveOutliers)
+
+CmdPointsRemoveOutliers::CmdPointsRemoveOutliers()
+    : Command("Points_RemoveOutliers")
+{
+    sAppModule = "Points";
+    sGroup = QT_TR_NOOP("Points");
+    sMenuText = QT_TR_NOOP("Remove outliers...");
+    sToolTipText = QT_TR_NOOP("Create point clouds without sparse outliers");
+    sWhatsThis = "Points_RemoveOutliers";
+    sStatusTip = QT_TR_NOOP("Create point clouds without sparse outliers");
+}
+
+void CmdPointsRemoveOutliers::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+
+    bool ok;
+    double stddev = QInputDialog::getDouble(Gui::getMainWindow(),
+                                            QObject::tr("Outliers"),
+                                            QObject::tr("Standard deviation multiplier:"),
+                                            1.0,
+                                            0.0,
+                                            10.0,
+                                            2,
+                                            &ok,
+                                            Qt::MSWindowsFixedSizeDialogHint);
+    if (!ok) {
+        return;
+    }
+
+    Gui::WaitCursor wc;
+    App::Document* doc = App::GetApplication().getActiveDocument();
+    openCommand(QT_TRANSLATE_NOOP("Command", "Remove outliers"));
+    std::vector<Points::Feature*> points = getSelection().getObjectsOfType<Points::Feature>();
+    try {
+        for (auto it : points) {
+            const Points::PointKernel& input = it->Points.getValue();
+            Points::OutlierRemoval filter(input);
+            filter.setStdDevMultiplier(stddev);
+            std::vector<unsigned long> inliers;
+            filter.perform(inliers);
+
+            std::string name = it->Label.getValue();
+            name += " (Filtered)";
+            auto output =
+                static_cast<Points::Feature*>(doc->addObject("Points::Feature", name.c_str()));
+            output->Label.setValue(name);
+
+            Points::PointKernel* kernel = output->Points.startEditing();
+            kernel->resize(inliers.size());
+            for (std::size_t i = 0; i < inliers.size(); ++i) {
+                kernel->setPoint(i, input.getPoint(static_cast<int>(inliers[i])));
+            }
+            output->Points.finishEditing();
+        }
+        commitCommand();
+    }
+    catch (const Base::Exception& e) {
+        abortCommand();
+        e.ReportException();
+    }
+    updateActive();
+}
+
+bool CmdPointsRemoveOutliers::isActive()
+{
+    return getSelection().countObjectsOfType(Points::Feature::getClassTypeId()) > 0;
+}
+
+DEF_STD_CMD_A(CmdPointsDownsample)
+
+CmdPointsDownsample::CmdPointsDownsample()
+    : Command("Points_Downsample")
+{
+    sAppModule = "Points";
+    sGroup = QT_TR_NOOP("Points");
+    sMenuText = QT_TR_NOOP("Downsample...");
+    sToolTipText = QT_TR_NOOP("Create point clouds with one point per voxel");
+    sWhatsThis = "Points_Downsample";
+    sStatusTip = QT_TR_NOOP("Create point clouds with one point per voxel");
+}
+
+void CmdPointsDownsample::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+
+    int decimals = Base::UnitsApi::getDecimals();
+    bool ok;
+    double size = QInputDialog::getDouble(Gui::getMainWindow(),
+                                          QObject::tr("Downsample"),
+                                          QObject::tr("Enter voxel size:"),
+                                          1.0,
+                                          std::pow(10., -decimals),
+                                          1000.0,
+                                          decimals,
+                                          &ok,
+                                          Qt::MSWindowsFixedSizeDialogHint);
+    if (!ok) {
+        return;
+    }
+
+    Gui::WaitCursor wc;
+    App::Document* doc = App::GetApplication().getActiveDocument();
+    openCommand(QT_TRANSLATE_NOOP("Command", "Downsample points"));
+    std::vector<Points::Feature*> points = getSelection().getObjectsOfType<Points::Feature>();
+    try {
+        for (auto it : points) {
+            Points::VoxelGridFilter filter(it->Points.getValue());
+            filter.setLeafSize(size, size, size);
+            Points::PointKernel kernel;
+            filter.perform(kernel);
+
+            std::string name = it->Label.getValue();
+            name += " (Downsampled)";
+            auto output =
+                static_cast<Points::Feature*>(doc->addObject("Points::Feature", name.c_str()));
+            output->Label.setValue(name);
+            output->Points.setValue(kernel);
+        }
+        commitCommand();
+    }
+    catch (const Base::Exception& e) {
+        abortCommand();
+        e.ReportException();
+    }
+    updateActive();
+}
+
+bool CmdPointsDownsample::isActive()
+{
+    return getSelection().countObjectsOfType(Points::Feature::getClassTypeId()) > 0;
+}
+
 void CreatePointsCommands()
 {
     Gui::CommandManager& rcCmdMgr = Gui::Application::Instance->commandManager();
@@ -517,4 +719,7 @@ void CreatePointsCommands()
     rcCmdMgr.addCommand(new CmdPointsPolyCut());
     rcCmdMgr.addCommand(new CmdPointsMerge());
     rcCmdMgr.addCommand(new CmdPointsStructure());
+    rcCmdMgr.addCommand(new CmdPointsEstimateNormals());
+    rcCmdMgr.addCommand(new CmdPointsRemoveOutliers());
+    rcCmdMgr.addCommand(new CmdPointsDownsample());
 }
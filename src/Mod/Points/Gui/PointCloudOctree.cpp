@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <Inventor/SbMatrix.h>
+#include <Inventor/SbViewVolume.h>
+#include <QtConcurrentMap>
+#endif
+
+#include "PointCloudOctree.h"
+
+
+using namespace PointsGui;
+
+namespace
+{
+constexpr int maxDepth = 16;
+// Octree cells up to this depth are processed concurrently
+constexpr int parallelDepth = 2;
+}  // namespace
+
+struct PointCloudOctree::Cell
+{
+    uint32_t first;
+    uint32_t count;
+    SbVec3f min;
+    SbVec3f max;
+    int depth;
+};
+
+void PointCloudOctree::clear()
+{
+    order.clear();
+    leaves.clear();
+    bbox.makeEmpty();
+}
+
+void PointCloudOctree::build(const std::vector<Base::Vector3f>& points)
+{
+    clear();
+
+    order.reserve(points.size());
+    Cell root {0, 0, SbVec3f(0, 0, 0), SbVec3f(0, 0, 0), 0};
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const Base::Vector3f& p = points[i];
+        if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z)) {
+            continue;
+        }
+        order.push_back(static_cast<uint32_t>(i));
+        bbox.extendBy(SbVec3f(p.x, p.y, p.z));
+    }
+    if (order.empty()) {
+        return;
+    }
+
+    root.count = static_cast<uint32_t>(order.size());
+    bbox.getBounds(root.min, root.max);
+
+    // split the upper levels here and build the sub-trees concurrently
+    std::vector<Cell> cells {root};
+    for (int level = 0; level < parallelDepth; level++) {
+        std::vector<Cell> next;
+        for (const auto& cell : cells) {
+            if (cell.count <= maxLeafSize) {
+                next.push_back(cell);
+            }
+            else {
+                splitCell(points, cell, next);
+            }
+        }
+        cells.swap(next);
+    }
+
+    std::vector<std::pair<Cell, std::vector<Leaf>>> tasks;
+    tasks.reserve(cells.size());
+    for (const auto& cell : cells) {
+        tasks.emplace_back(cell, std::vector<Leaf>());
+    }
+    QtConcurrent::blockingMap(tasks, [this, &points](std::pair<Cell, std::vector<Leaf>>& task) {
+        buildLeaves(points, task.first, task.second);
+    });
+    for (const auto& task : tasks) {
+        leaves.insert(leaves.end(), task.second.begin(), task.second.end());
+    }
+}
+
+void PointCloudOctree::splitCell(const std::vector<Base::Vector3f>& points,
+                                 const Cell& cell,
+                                 std::vector<Cell>& children)
+{
+    SbVec3f mid = (cell.min + cell.max) * 0.5F;
+
+    // three nested partitions sort the points into the eight octants
+    auto begin = order.begin() + cell.first;
+    auto end = begin + cell.count;
+    std::array<std::vector<uint32_t>::iterator, 9> bounds;
+    bounds[0] = begin;
+    bounds[8] = end;
+    bounds[4] = std::partition(begin, end, [&](uint32_t i) {
+        return points[i].x < mid[0];
+    });
+    for (int i = 0; i < 8; i += 4) {
+        bounds[i + 2] = std::partition(bounds[i], bounds[i + 4], [&](uint32_t j) {
+            return points[j].y < mid[1];
+        });
+    }
+    for (int i = 0; i < 8; i += 2) {
+        bounds[i + 1] = std::partition(bounds[i], bounds[i + 2], [&](uint32_t j) {
+            return points[j].z < mid[2];
+        });
+    }
+
+    for (int i = 0; i < 8; i++) {
+        auto count = static_cast<uint32_t>(bounds[i + 1] - bounds[i]);
+        if (count == 0) {
+            continue;
+        }
+        Cell child {static_cast<uint32_t>(bounds[i] - order.begin()),
+                    count,
+                    cell.min,
+                    cell.max,
+                    cell.depth + 1};
+        for (int axis = 0; axis < 3; axis++) {
+            // bit 2 is x, bit 1 is y and bit 0 is z
+            if (i & (4 >> axis)) {
+                child.min[axis] = mid[axis];
+            }
+            else {
+                child.max[axis] = mid[axis];
+            }
+        }
+        children.push_back(child);
+    }
+}
+
+void PointCloudOctree::buildLeaves(const std::vector<Base::Vector3f>& points,
+                                   const Cell& cell,
+                                   std::vector<Leaf>& result)
+{
+    if (cell.count <= maxLeafSize || cell.depth >= maxDepth) {
+        makeLeaf(points, cell, result);
+        return;
+    }
+
+    std::vector<Cell> children;
+    splitCell(points, cell, children);
+    for (const auto& child : children) {
+        buildLeaves(points, child, result);
+    }
+}
+
+void PointCloudOctree::makeLeaf(const std::vector<Base::Vector3f>& points,
+                                const Cell& cell,
+                                std::vector<Leaf>& result)
+{
+    auto begin = order.begin() + cell.first;
+    auto end = begin + cell.count;
+
+    // with a fixed seed the same subsets are drawn in every session
+    std::mt19937 gen(cell.first);
+    std::shuffle(begin, end, gen);
+
+    Leaf leaf {SbBox3f(), cell.first, cell.count};
+    for (auto it = begin; it != end; ++it) {
+        const Base::Vector3f& p = points[*it];
+        leaf.box.extendBy(SbVec3f(p.x, p.y, p.z));
+    }
+    result.push_back(leaf);
+}
+
+std::vector<std::pair<uint32_t, uint32_t>>
+PointCloudOctree::selectPoints(const SbViewVolume& vv,
+                               const SbMatrix& model,
+                               float viewportHeight,
+                               uint64_t budget,
+                               bool& complete) const
+{
+    // the number of points a leaf needs is estimated by its projected area
+    std::vector<std::pair<std::size_t, uint64_t>> visible;
+    uint64_t total = 0;
+    for (std::size_t i = 0; i < leaves.size(); i++) {
+        const Leaf& leaf = leaves[i];
+        SbBox3f box = leaf.box;
+        box.transform(model);
+        if (!vv.intersect(box)) {
+            continue;
+        }
+
+        SbVec3f size = box.getMax() - box.getMin();
+        float scale = vv.getWorldToScreenScale(box.getCenter(), 1.0F);
+        uint64_t need = leaf.count;
+        if (scale > 0.0F) {
+            double diameter = size.length() / scale * viewportHeight;
+            need = std::min<uint64_t>(leaf.count, uint64_t(diameter * diameter));
+        }
+        need = std::max<uint64_t>(need, std::min(leaf.count, minLeafPoints));
+        visible.emplace_back(i, need);
+        total += need;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    ranges.reserve(visible.size());
+    complete = true;
+    double factor = total > 0 ? double(budget) / double(total) : 1.0;
+    for (const auto& it : visible) {
+        const Leaf& leaf = leaves[it.first];
+        auto count = static_cast<uint32_t>(
+            std::min<double>(leaf.count, std::ceil(double(it.second) * factor)));
+        if (count < leaf.count) {
+            complete = false;
+        }
+        if (count > 0) {
+            ranges.emplace_back(leaf.first, count);
+        }
+    }
+
+    return ranges;
+}
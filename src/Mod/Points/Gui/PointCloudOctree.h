@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#ifndef POINTSGUI_POINTCLOUDOCTREE_H
+#define POINTSGUI_POINTCLOUDOCTREE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Inventor/SbBox3f.h>
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+class SbMatrix;
+class SbViewVolume;
+
+namespace PointsGui
+{
+
+/**
+ * The PointCloudOctree class sorts the points of a point cloud into the leaves
+ * of an octree and decides which of them are drawn by SoFCPointCloud.
+ *
+ * The points of each leaf are shuffled so that any prefix of a leaf is a uniform
+ * subsample of it. The class doesn't use OpenGL.
+ */
+class PointsGuiExport PointCloudOctree
+{
+public:
+    struct Leaf
+    {
+        SbBox3f box;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /// Leaves are not split any further once they have this number of points
+    static constexpr std::size_t maxLeafSize = 32768;
+    /// Smallest number of points drawn of a visible leaf
+    static constexpr uint32_t minLeafPoints = 64;
+
+    /// Builds the tree, points with NaN coordinates are skipped
+    void build(const std::vector<Base::Vector3f>& points);
+    void clear();
+
+    /// The point indices sorted by leaves and shuffled inside each leaf
+    const std::vector<uint32_t>& getOrder() const
+    {
+        return order;
+    }
+    const std::vector<Leaf>& getLeaves() const
+    {
+        return leaves;
+    }
+    const SbBox3f& getBoundBox() const
+    {
+        return bbox;
+    }
+
+    /**
+     * Distributes at most \a budget points over the leaves inside the view volume
+     * by their projected size and returns them as ranges (first, count) of the
+     * order. \a complete is set to false if any visible point is left out.
+     */
+    std::vector<std::pair<uint32_t, uint32_t>> selectPoints(const SbViewVolume& vv,
+                                                             const SbMatrix& model,
+                                                             float viewportHeight,
+                                                             uint64_t budget,
+                                                             bool& complete) const;
+
+private:
+    struct Cell;
+    void splitCell(const std::vector<Base::Vector3f>& points,
+                   const Cell& cell,
+                   std::vector<Cell>& children);
+    void buildLeaves(const std::vector<Base::Vector3f>& points,
+                     const Cell& cell,
+                     std::vector<Leaf>& result);
+    void makeLeaf(const std::vector<Base::Vector3f>& points,
+                  const Cell& cell,
+                  std::vector<Leaf>& result);
+
+private:
+    std::vector<uint32_t> order;
+    std::vector<Leaf> leaves;
+    SbBox3f bbox;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_POINTCLOUDOCTREE_H
@@ -0,0 +1,442 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef FC_OS_WIN32
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+#endif
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#ifdef FC_OS_MACOSX
+#include <OpenGL/gl.h>
+#include <OpenGL/glext.h>
+#else
+#include <GL/gl.h>
+#include <GL/glext.h>
+#endif
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/bundles/SoMaterialBundle.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoGLCacheContextElement.h>
+#include <Inventor/elements/SoGLLazyElement.h>
+#include <Inventor/elements/SoLazyElement.h>
+#include <Inventor/elements/SoMaterialBindingElement.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoNormalBindingElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
+#include <Inventor/sensors/SoOneShotSensor.h>
+#endif
+
+#include <Inventor/C/glue/gl.h>
+
+#include <App/Color.h>
+#include <Base/Handle.h>
+#include <Gui/GLBuffer.h>
+#include <Gui/SoFCInteractiveElement.h>
+#include <Mod/Points/App/Points.h>
+
+#include "PointCloudOctree.h"
+#include "SoFCPointCloud.h"
+
+
+using namespace PointsGui;
+
+class SoFCPointCloud::Private
+{
+public:
+    Base::Reference<const Points::PointKernel> kernel;
+    PointCloudOctree octree;
+    // RGBA per point
+    std::vector<uint8_t> colors;
+    // normalized xyz per point padded to four bytes
+    std::vector<int8_t> normals;
+
+    Gui::OpenGLMultiBuffer vertices;
+    Gui::OpenGLMultiBuffer colorBuffer;
+    Gui::OpenGLMultiBuffer normalBuffer;
+
+    SoOneShotSensor refineSensor;
+    unsigned int refineLevel {0};
+    unsigned long renderedPoints {0};
+
+    explicit Private(SoFCPointCloud* node)
+        : vertices(GL_ARRAY_BUFFER)
+        , colorBuffer(GL_ARRAY_BUFFER)
+        , normalBuffer(GL_ARRAY_BUFFER)
+        , refineSensor(&SoFCPointCloud::refineCB, node)
+    {}
+
+    std::size_t countPoints() const
+    {
+        return kernel.isValid() ? kernel->size() : 0;
+    }
+    bool hasColors() const
+    {
+        return !colors.empty() && colors.size() == 4 * countPoints();
+    }
+    bool hasNormals() const
+    {
+        return !normals.empty() && normals.size() == 4 * countPoints();
+    }
+
+    bool canRenderGLArray(SoGLRenderAction* action) const;
+    void uploadBuffers(uint32_t context);
+    template<typename T>
+    void uploadBuffer(Gui::OpenGLMultiBuffer& buffer,
+                      uint32_t context,
+                      const T* data,
+                      std::size_t elements);
+};
+
+bool SoFCPointCloud::Private::canRenderGLArray(SoGLRenderAction* action) const
+{
+    static bool init = false;
+    static bool vboAvailable = false;
+    if (!init) {
+        vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+        init = true;
+    }
+
+    // get the VBO status of the viewer
+    SbBool useVBO = true;
+    Gui::SoGLVBOActivatedElement::get(action->getState(), useVBO);
+    return vboAvailable && useVBO;
+}
+
+template<typename T>
+void SoFCPointCloud::Private::uploadBuffer(Gui::OpenGLMultiBuffer& buffer,
+                                           uint32_t context,
+                                           const T* data,
+                                           std::size_t elements)
+{
+    // copy the data in octree order in chunks to keep the temporary memory small
+    const std::size_t chunkSize = 1 << 20;
+    const cc_glglue* glue = cc_glglue_instance(context);
+    const std::vector<uint32_t>& order = octree.getOrder();
+
+    buffer.setCurrentContext(context);
+    buffer.create();
+    buffer.bind();
+    // don't use allocate() because large point clouds may exceed the int range
+    cc_glglue_glBufferData(glue,
+                           GL_ARRAY_BUFFER,
+                           static_cast<intptr_t>(order.size() * elements * sizeof(T)),
+                           nullptr,
+                           GL_STATIC_DRAW);
+
+    std::vector<T> chunk;
+    chunk.reserve(chunkSize * elements);
+    for (std::size_t pos = 0; pos < order.size(); pos += chunkSize) {
+        std::size_t num = std::min(chunkSize, order.size() - pos);
+        chunk.clear();
+        for (std::size_t i = pos; i < pos + num; i++) {
+            const T* item = data + std::size_t(order[i]) * elements;
+            chunk.insert(chunk.end(), item, item + elements);
+        }
+        cc_glglue_glBufferSubData(glue,
+                                  GL_ARRAY_BUFFER,
+                                  static_cast<intptr_t>(pos * elements * sizeof(T)),
+                                  static_cast<intptr_t>(num * elements * sizeof(T)),
+                                  chunk.data());
+    }
+    buffer.release();
+}
+
+void SoFCPointCloud::Private::uploadBuffers(uint32_t context)
+{
+    if (!vertices.isCreated(context)) {
+        const auto& points = kernel->getBasicPoints();
+        uploadBuffer(vertices, context, &points[0].x, 3);
+    }
+    if (hasColors() && !colorBuffer.isCreated(context)) {
+        uploadBuffer(colorBuffer, context, colors.data(), 4);
+    }
+    if (hasNormals() && !normalBuffer.isCreated(context)) {
+        uploadBuffer(normalBuffer, context, normals.data(), 4);
+    }
+}
+
+// ------------------------------------------------------------------
+
+SO_NODE_SOURCE(SoFCPointCloud)
+
+void SoFCPointCloud::initClass()
+{
+    SO_NODE_INIT_CLASS(SoFCPointCloud, SoShape, "Shape");
+}
+
+SoFCPointCloud::SoFCPointCloud()
+    : d(new Private(this))
+{
+    SO_NODE_CONSTRUCTOR(SoFCPointCloud);
+    SO_NODE_ADD_FIELD(pointBudget, (2000000));
+}
+
+SoFCPointCloud::~SoFCPointCloud()
+{
+    d->refineSensor.unschedule();
+}
+
+void SoFCPointCloud::refineCB(void* data, SoSensor*)
+{
+    static_cast<SoFCPointCloud*>(data)->touch();
+}
+
+void SoFCPointCloud::setPoints(const Points::PointKernel* kernel)
+{
+    d->kernel = kernel;
+    if (d->kernel.isValid()) {
+        d->octree.build(d->kernel->getBasicPoints());
+    }
+    else {
+        d->octree.clear();
+    }
+    d->vertices.destroy();
+    d->colorBuffer.destroy();
+    d->normalBuffer.destroy();
+    d->refineLevel = 0;
+    touch();
+}
+
+void SoFCPointCloud::setColors(const std::vector<App::Color>& colors)
+{
+    d->colors.resize(4 * colors.size());
+    uint8_t* rgba = d->colors.data();
+    for (const auto& it : colors) {
+        *rgba++ = static_cast<uint8_t>(it.r * 255.0F + 0.5F);
+        *rgba++ = static_cast<uint8_t>(it.g * 255.0F + 0.5F);
+        *rgba++ = static_cast<uint8_t>(it.b * 255.0F + 0.5F);
+        *rgba++ = 255;
+    }
+    d->colorBuffer.destroy();
+    touch();
+}
+
+void SoFCPointCloud::setGreyValues(const std::vector<float>& values)
+{
+    d->colors.resize(4 * values.size());
+    uint8_t* rgba = d->colors.data();
+    for (float it : values) {
+        auto grey = static_cast<uint8_t>(std::clamp(it, 0.0F, 1.0F) * 255.0F + 0.5F);
+        *rgba++ = grey;
+        *rgba++ = grey;
+        *rgba++ = grey;
+        *rgba++ = 255;
+    }
+    d->colorBuffer.destroy();
+    touch();
+}
+
+void SoFCPointCloud::setNormals(const std::vector<Base::Vector3f>& normals)
+{
+    d->normals.resize(4 * normals.size());
+    int8_t* xyz = d->normals.data();
+    for (const auto& it : normals) {
+        Base::Vector3f n = it;
+        n.Normalize();
+        *xyz++ = static_cast<int8_t>(std::lround(n.x * 127.0F));
+        *xyz++ = static_cast<int8_t>(std::lround(n.y * 127.0F));
+        *xyz++ = static_cast<int8_t>(std::lround(n.z * 127.0F));
+        *xyz++ = 0;
+    }
+    d->normalBuffer.destroy();
+    touch();
+}
+
+unsigned long SoFCPointCloud::getNumPoints() const
+{
+    return static_cast<unsigned long>(d->octree.getOrder().size());
+}
+
+unsigned long SoFCPointCloud::getNumRenderedPoints() const
+{
+    return d->renderedPoints;
+}
+
+void SoFCPointCloud::GLRender(SoGLRenderAction* action)
+{
+    if (d->octree.getOrder().empty() || !shouldGLRender(action)) {
+        return;
+    }
+
+    SoState* state = action->getState();
+    // the drawn points depend on the camera and the refinement level
+    SoGLCacheContextElement::shouldAutoCache(state, SoGLCacheContextElement::DONT_AUTO_CACHE);
+
+    bool interactive = Gui::SoFCInteractiveElement::get(state);
+    if (interactive) {
+        d->refineLevel = 0;
+    }
+    uint64_t budget = std::max<uint64_t>(pointBudget.getValue(), 1)
+        << std::min(d->refineLevel, 32U);
+
+    bool complete = true;
+    const SbViewportRegion& vp = SoViewportRegionElement::get(state);
+    auto ranges = d->octree.selectPoints(SoViewVolumeElement::get(state),
+                                         SoModelMatrixElement::get(state),
+                                         static_cast<float>(vp.getViewportSizePixels()[1]),
+                                         budget,
+                                         complete);
+    if (!interactive && !complete) {
+        d->refineLevel++;
+        d->refineSensor.schedule();
+    }
+
+    bool useColors = d->hasColors()
+        && SoMaterialBindingElement::get(state) != SoMaterialBindingElement::OVERALL;
+    bool useNormals = d->hasNormals()
+        && (SoNormalBindingElement::get(state) == SoNormalBindingElement::PER_VERTEX
+            || SoNormalBindingElement::get(state) == SoNormalBindingElement::PER_VERTEX_INDEXED);
+
+    state->push();
+    if (!useNormals) {
+        SoLazyElement::setLightModel(state, SoLazyElement::BASE_COLOR);
+    }
+
+    SoMaterialBundle mb(action);
+    mb.sendFirst();
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    if (useColors) {
+        glEnableClientState(GL_COLOR_ARRAY);
+    }
+    if (useNormals) {
+        glEnableClientState(GL_NORMAL_ARRAY);
+    }
+
+    unsigned long rendered = 0;
+    if (d->canRenderGLArray(action)) {
+        uint32_t context = action->getCacheContext();
+        d->uploadBuffers(context);
+
+        d->vertices.setCurrentContext(context);
+        d->vertices.bind();
+        glVertexPointer(3, GL_FLOAT, 0, nullptr);
+        if (useColors) {
+            d->colorBuffer.setCurrentContext(context);
+            d->colorBuffer.bind();
+            glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr);
+        }
+        if (useNormals) {
+            d->normalBuffer.setCurrentContext(context);
+            d->normalBuffer.bind();
+            glNormalPointer(GL_BYTE, 4, nullptr);
+        }
+
+        for (const auto& it : ranges) {
+            glDrawArrays(GL_POINTS, GLint(it.first), GLsizei(it.second));
+            rendered += it.second;
+        }
+
+        d->vertices.release();
+    }
+    else {
+        // without buffer objects the kernel's points are used directly
+        const auto& points = d->kernel->getBasicPoints();
+        glVertexPointer(3, GL_FLOAT, sizeof(Base::Vector3f), &points[0].x);
+        if (useColors) {
+            glColorPointer(4, GL_UNSIGNED_BYTE, 0, d->colors.data());
+        }
+        if (useNormals) {
+            glNormalPointer(GL_BYTE, 4, d->normals.data());
+        }
+
+        for (const auto& it : ranges) {
+            glDrawElements(GL_POINTS, GLsizei(it.second), GL_UNSIGNED_INT, &d->octree.getOrder()[it.first]);
+            rendered += it.second;
+        }
+    }
+
+    if (useNormals) {
+        glDisableClientState(GL_NORMAL_ARRAY);
+    }
+    if (useColors) {
+        glDisableClientState(GL_COLOR_ARRAY);
+        // the current color is undefined after drawing a color array
+        SoGLLazyElement::getInstance(state)->reset(state, SoLazyElement::DIFFUSE_MASK);
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    state->pop();
+
+    d->renderedPoints = rendered;
+}
+
+void SoFCPointCloud::computeBBox(SoAction*, SbBox3f& box, SbVec3f& center)
+{
+    const SbBox3f& bbox = d->octree.getBoundBox();
+    if (!bbox.isEmpty()) {
+        box = bbox;
+        center = box.getCenter();
+    }
+    else {
+        box.setBounds(SbVec3f(0, 0, 0), SbVec3f(0, 0, 0));
+        center.setValue(0.0F, 0.0F, 0.0F);
+    }
+}
+
+void SoFCPointCloud::getPrimitiveCount(SoGetPrimitiveCountAction* action)
+{
+    if (!this->shouldPrimitiveCount(action)) {
+        return;
+    }
+    action->addNumPoints(static_cast<int>(d->octree.getOrder().size()));
+}
+
+void SoFCPointCloud::generatePrimitives(SoAction* action)
+{
+    if (d->octree.getOrder().empty()) {
+        return;
+    }
+
+    const auto& points = d->kernel->getBasicPoints();
+    bool useColors = d->hasColors()
+        && SoMaterialBindingElement::get(action->getState())
+            != SoMaterialBindingElement::OVERALL;
+
+    SoPrimitiveVertex vertex;
+    SoPointDetail pointDetail;
+    vertex.setDetail(&pointDetail);
+
+    beginShape(action, POINTS);
+    for (uint32_t index : d->octree.getOrder()) {
+        const Base::Vector3f& p = points[index];
+        pointDetail.setCoordinateIndex(int(index));
+        vertex.setPoint(SbVec3f(p.x, p.y, p.z));
+        if (useColors) {
+            pointDetail.setMaterialIndex(int(index));
+            vertex.setMaterialIndex(int(index));
+        }
+        shapeVertex(&vertex);
+    }
+    endShape();
+}
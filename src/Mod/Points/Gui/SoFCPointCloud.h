@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTSGUI_SOFCPOINTCLOUD_H
+#define POINTSGUI_SOFCPOINTCLOUD_H
+
+#include <memory>
+#include <vector>
+#include <Inventor/fields/SoSFUInt32.h>
+#include <Inventor/nodes/SoShape.h>
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+class SoSensor;
+
+namespace App
+{
+class Color;
+}
+
+namespace Points
+{
+class PointKernel;
+}
+
+namespace PointsGui
+{
+
+/**
+ * The SoFCPointCloud class renders the points of a point kernel directly,
+ * i.e. without copying them into an SoCoordinate3 node first.
+ *
+ * The points are sorted into the leaves of an octree and shuffled inside each
+ * leaf so that any prefix of a leaf is a uniform subsample of it. While the
+ * camera moves at most \a pointBudget points are drawn, distributed over the
+ * visible leaves by their projected size. As soon as the camera stops the
+ * budget is doubled with every frame until all visible points are drawn.
+ *
+ * If vertex buffer objects are available the coordinates, colors and normals
+ * are uploaded once per OpenGL context in octree order.
+ *
+ * Colors are used if the material binding is not OVERALL and normals if the
+ * normal binding is PER_VERTEX.
+ */
+class PointsGuiExport SoFCPointCloud: public SoShape
+{
+    using inherited = SoShape;
+
+    SO_NODE_HEADER(SoFCPointCloud);
+
+public:
+    static void initClass();
+    SoFCPointCloud();
+
+    /// Maximum number of points per frame while interacting
+    SoSFUInt32 pointBudget;
+
+    void setPoints(const Points::PointKernel*);
+    void setColors(const std::vector<App::Color>&);
+    void setGreyValues(const std::vector<float>&);
+    void setNormals(const std::vector<Base::Vector3f>&);
+    /// Number of points with valid coordinates
+    unsigned long getNumPoints() const;
+    /// Number of points drawn in the last frame
+    unsigned long getNumRenderedPoints() const;
+
+protected:
+    void GLRender(SoGLRenderAction* action) override;
+    void computeBBox(SoAction* action, SbBox3f& box, SbVec3f& center) override;
+    void getPrimitiveCount(SoGetPrimitiveCountAction* action) override;
+    void generatePrimitives(SoAction* action) override;
+    // Force using the reference count mechanism.
+    ~SoFCPointCloud() override;
+
+private:
+    static void refineCB(void* data, SoSensor* sensor);
+
+private:
+    class Private;
+    std::unique_ptr<Private> d;
+};
+
+}  // namespace PointsGui
+
+
+#endif  // POINTSGUI_SOFCPOINTCLOUD_H
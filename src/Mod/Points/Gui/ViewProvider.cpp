@@ -34,9 +34,11 @@
 #include <Inventor/nodes/SoMaterial.h>
 #include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoNormal.h>
+#include <Inventor/nodes/SoNormalBinding.h>
 #include <Inventor/nodes/SoPointSet.h>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
@@ -46,6 +48,7 @@
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/Properties.h>
 
+#include "SoFCPointCloud.h"
 #include "ViewProvider.h"
 
 
@@ -158,7 +161,10 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
 
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
-    int numPoints = pcPointsCoord->point.getNum();
+    int numPoints = 0;
+    if (auto fea = dynamic_cast<Points::Feature*>(pcObject)) {
+        numPoints = static_cast<int>(fea->Points.getValue().size());
+    }
 
     if (strcmp("Color", ModeName) == 0) {
         std::map<std::string, App::Property*> Map;
@@ -368,8 +374,12 @@ PROPERTY_SOURCE(PointsGui::ViewProviderScattered, PointsGui::ViewProviderPoints)
 
 ViewProviderScattered::ViewProviderScattered()
 {
-    pcPoints = new SoPointSet();
+    pcPoints = new SoFCPointCloud();
     pcPoints->ref();
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Points");
+    pcPoints->pointBudget = hGrp->GetUnsigned("PointBudget", 2000000);
 }
 
 ViewProviderScattered::~ViewProviderScattered()
@@ -387,7 +397,6 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     pcHighlight->subElementName = "Main";
 
     // Highlight for selection
-    pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
 
     std::vector<std::string> modes = getDisplayModes();
@@ -404,7 +413,9 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
         SoGroup* pcPointShadedRoot = new SoGroup();
         pcPointShadedRoot->addChild(pcPointStyle);
         pcPointShadedRoot->addChild(pcShapeMaterial);
-        pcPointShadedRoot->addChild(pcPointsNormal);
+        SoNormalBinding* pcNormBinding = new SoNormalBinding;
+        pcNormBinding->value = SoNormalBinding::PER_VERTEX;
+        pcPointShadedRoot->addChild(pcNormBinding);
         pcPointShadedRoot->addChild(pcHighlight);
         addDisplayMaskMode(pcPointShadedRoot, "Shaded");
     }
@@ -427,8 +438,7 @@ void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        pcPoints->setPoints(&static_cast<const Points::PropertyPointKernel*>(prop)->getValue());
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -444,6 +454,21 @@ void ViewProviderScattered::updateData(const App::Property* prop)
     }
 }
 
+void ViewProviderScattered::setVertexColorMode(App::PropertyColorList* pcProperty)
+{
+    pcPoints->setColors(pcProperty->getValues());
+}
+
+void ViewProviderScattered::setVertexGreyvalueMode(Points::PropertyGreyValueList* pcProperty)
+{
+    pcPoints->setGreyValues(pcProperty->getValues());
+}
+
+void ViewProviderScattered::setVertexNormalMode(Points::PropertyNormalList* pcProperty)
+{
+    pcPoints->setNormals(pcProperty->getValues());
+}
+
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked,
                                 Gui::View3DInventorViewer& Viewer)
 {
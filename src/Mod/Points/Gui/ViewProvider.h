@@ -60,6 +60,8 @@ class Feature;
 namespace PointsGui
 {
 
+class SoFCPointCloud;
+
 class ViewProviderPointsBuilder: public Gui::ViewProviderBuilder
 {
 public:
@@ -101,9 +103,9 @@ public:
 
 protected:
     void onChanged(const App::Property* prop) override;
-    void setVertexColorMode(App::PropertyColorList*);
-    void setVertexGreyvalueMode(Points::PropertyGreyValueList*);
-    void setVertexNormalMode(Points::PropertyNormalList*);
+    virtual void setVertexColorMode(App::PropertyColorList*);
+    virtual void setVertexGreyvalueMode(Points::PropertyGreyValueList*);
+    virtual void setVertexNormalMode(Points::PropertyNormalList*);
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) = 0;
 
 protected:
@@ -139,10 +141,13 @@ public:
     void updateData(const App::Property*) override;
 
 protected:
+    void setVertexColorMode(App::PropertyColorList*) override;
+    void setVertexGreyvalueMode(Points::PropertyGreyValueList*) override;
+    void setVertexNormalMode(Points::PropertyNormalList*) override;
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
 protected:
-    SoPointSet* pcPoints;
+    SoFCPointCloud* pcPoints;
 };
 
 /**
@@ -86,6 +86,10 @@ Gui::MenuItem* Workbench::setupMenuBar() const
           << "Points_Export"
           << "Separator"
           << "Points_PolyCut"
-          << "Points_Merge";
+          << "Points_Merge"
+          << "Separator"
+          << "Points_EstimateNormals"
+          << "Points_RemoveOutliers"
+          << "Points_Downsample";
     return root;
 }
@@ -24,6 +24,7 @@
 #ifndef _PreComp_
 #include <Geom_BSplineSurface.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <memory>
 #endif
 
 #include <Base/Console.h>
@@ -34,6 +35,7 @@
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/Part/App/BSplineSurfacePy.h>
 #include <Mod/Points/App/PointsPy.h>
+#include <Mod/Points/App/Processing.h>
 #if defined(HAVE_PCL_FILTERS)
 #include <pcl/filters/passthrough.h>
 #include <pcl/filters/voxel_grid.h>
@@ -119,7 +121,6 @@ public:
             "fitBSpline(PointKernel)."
         );
 #endif
-#if defined(HAVE_PCL_FILTERS)
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
             "filterVoxelGrid(dim)."
         );
@@ -141,7 +142,6 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
@@ -628,6 +628,41 @@ Mesh.show(m)
 
         return Py::asObject(new Points::PointsPy(points_sample));
     }
+#else
+    Py::Object filterVoxelGrid(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        double voxDimX = 0;
+        double voxDimY = 0;
+        double voxDimZ = 0;
+
+        static const std::array<const char*,5>  kwds_voxel {"Points", "DimX", "DimY", "DimZ", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!d|dd", kwds_voxel,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &voxDimX, &voxDimY, &voxDimZ))
+            throw Py::Exception();
+
+        if (voxDimY == 0)
+            voxDimY = voxDimX;
+
+        if (voxDimZ == 0)
+            voxDimZ = voxDimX;
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        try {
+            Points::VoxelGridFilter filter(*points);
+            filter.setLeafSize(voxDimX, voxDimY, voxDimZ);
+
+            std::unique_ptr<Points::PointKernel> points_sample(new Points::PointKernel());
+            filter.perform(*points_sample);
+
+            return Py::asObject(new Points::PointsPy(points_sample.release()));
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+    }
 #endif
 #if defined(HAVE_PCL_FILTERS)
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
@@ -655,6 +690,39 @@ Mesh.show(m)
             list.append(Py::Vector(*it));
         }
 
+        return list;
+    }
+#else
+    Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        int ksearch=0;
+        double searchRadius=0;
+
+        static const std::array<const char*,4> kwds_normals {"Points", "KSearch", "SearchRadius", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_normals,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &ksearch, &searchRadius))
+            throw Py::Exception();
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        std::vector<Base::Vector3f> normals;
+        try {
+            Points::NormalEstimation estimate(*points);
+            estimate.setKSearch(ksearch);
+            estimate.setSearchRadius(searchRadius);
+            estimate.perform(normals);
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+
+        Py::List list;
+        for (std::vector<Base::Vector3f>::iterator it = normals.begin(); it != normals.end(); ++it) {
+            list.append(Py::Vector(*it));
+        }
+
         return list;
     }
 #endif
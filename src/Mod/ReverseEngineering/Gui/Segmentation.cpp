@@ -85,20 +85,28 @@ void Segmentation::accept()
     MeshCore::MeshKernel kernel = mesh->getKernel();
     MeshCore::MeshAlgorithm algo(kernel);
 
+    std::shared_ptr<const std::vector<MeshCore::CurvatureInfo>> curvature;
     if (ui->checkBoxSmooth->isChecked()) {
         MeshCore::LaplaceSmoothing smoother(kernel);
         smoother.Smooth(ui->smoothSteps->value());
+        MeshCore::MeshCurvature meshCurv(kernel);
+        meshCurv.ComputePerVertex();
+        curvature =
+            std::make_shared<const std::vector<MeshCore::CurvatureInfo>>(meshCurv.GetCurvature());
+    }
+    else {
+        // the curvature of the unmodified mesh is cached
+        curvature = mesh->getCurvaturePerVertex();
     }
 
     MeshCore::MeshSegmentAlgorithm finder(kernel);
-    MeshCore::MeshCurvature meshCurv(kernel);
-    meshCurv.ComputePerVertex();
+    finder.setParallel(true);
 
     // First create segments by curavture to get the surface type
     std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
     if (ui->groupBoxPln->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(*curvature,
                                                                    ui->numPln->value(),
                                                                    ui->curvTolPln->value()));
     }
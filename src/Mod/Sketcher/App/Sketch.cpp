@@ -71,6 +71,8 @@ Sketch::Sketch()
     : SolveTime(0)
     , RecalculateInitialSolutionWhileMovingPoint(false)
     , resolveAfterGeometryUpdated(false)
+    , SetUpExtGeoCount(0)
+    , SetUpReused(false)
     , GCSsys()
     , ConstraintsCounter(0)
     , isInitMove(false)
@@ -135,6 +137,9 @@ void Sketch::clear()
     // NonDrivingConstraints.end(); ++it)
     //    if (*it) delete *it;
     Constrs.clear();
+    SetUpConstrs.clear();
+    SetUpExtGeoCount = 0;
+    SetUpReused = false;
 
     GCSsys.clear();
     isInitMove = false;
@@ -338,6 +343,13 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 
     calculateDependentParametersElements();
 
+    // remember what the solver system was built from, so that updateDatums() can reuse it
+    SetUpConstrs.reserve(ConstraintList.size());
+    for (auto constraint : ConstraintList) {
+        SetUpConstrs.push_back(getConstrTopology(constraint));
+    }
+    SetUpExtGeoCount = extGeoCount;
+
     if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
         Base::TimeElapsed end_time;
 
@@ -348,6 +360,129 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
     return GCSsys.dofsNumber();
 }
 
+bool Sketch::ConstrTopology::operator==(const ConstrTopology& other) const
+{
+    return type == other.type && alignmentType == other.alignmentType && first == other.first
+        && firstPos == other.firstPos && second == other.second && secondPos == other.secondPos
+        && third == other.third && thirdPos == other.thirdPos && driving == other.driving
+        && active == other.active && internalAlignmentIndex == other.internalAlignmentIndex
+        && value == other.value;
+}
+
+bool Sketch::isDatumParameter(const Constraint* constraint)
+{
+    switch (constraint->Type) {
+        case DistanceX:
+        case DistanceY:
+        case Distance:
+        case Angle:
+        case Radius:
+        case Diameter:
+        case Weight:
+        case SnellsLaw:
+            return true;
+        default:
+            // e.g. the angle of tangent and perpendicular constraints is offset or auto-detected
+            return false;
+    }
+}
+
+Sketch::ConstrTopology Sketch::getConstrTopology(const Constraint* constraint)
+{
+    ConstrTopology topo;
+    topo.type = constraint->Type;
+    topo.alignmentType = constraint->AlignmentType;
+    topo.first = constraint->First;
+    topo.firstPos = constraint->FirstPos;
+    topo.second = constraint->Second;
+    topo.secondPos = constraint->SecondPos;
+    topo.third = constraint->Third;
+    topo.thirdPos = constraint->ThirdPos;
+    topo.driving = constraint->isDriving;
+    topo.active = constraint->isActive;
+    topo.internalAlignmentIndex = constraint->InternalAlignmentIndex;
+    topo.value = isDatumParameter(constraint) ? 0.0 : constraint->getValue();
+    return topo;
+}
+
+bool Sketch::isSameGeometry(const std::vector<Part::Geometry*>& GeoList, int extGeoCount) const
+{
+    if (extGeoCount != SetUpExtGeoCount || GeoList.size() != Geoms.size()) {
+        return false;
+    }
+
+    // After a successful solve the geometry of the sketch is updated with the solver parameters,
+    // so unchanged geometry means that the solver parameters are up to date, too.
+    for (std::size_t i = 0; i < GeoList.size(); i++) {
+        const Part::Geometry* geo = GeoList[i];
+        const Part::Geometry* solverGeo = Geoms[i].geo;
+        if (!geo || !solverGeo || geo->getTypeId() != solverGeo->getTypeId()
+            || GeometryFacade::getConstruction(geo) != GeometryFacade::getConstruction(solverGeo)
+            || GeometryFacade::getBlocked(geo) != GeometryFacade::getBlocked(solverGeo)
+            || GeometryFacade::getInternalType(geo) != GeometryFacade::getInternalType(solverGeo)
+            || !geo->isSame(*solverGeo, Precision::Confusion(), Precision::Angular())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Sketch::updateDatums(const std::vector<Part::Geometry*>& GeoList,
+                          const std::vector<Constraint*>& ConstraintList,
+                          int extGeoCount)
+{
+    SetUpReused = false;
+
+    // a problematic sketch is diagnosed again, as the numerical rank may depend on the datums
+    if (Geoms.empty() || hasConflicts() || hasRedundancies() || hasMalformedConstraints()
+        || ConstraintList.size() != SetUpConstrs.size()
+        || !isSameGeometry(GeoList, extGeoCount)) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < ConstraintList.size(); i++) {
+        if (!(getConstrTopology(ConstraintList[i]) == SetUpConstrs[i])) {
+            return false;
+        }
+    }
+
+    // Constrs only holds the constraints that were added to the solver, block, inactive and
+    // unenforceable constraints are skipped
+    for (auto& it : Constrs) {
+        if (it.index < 0 || it.index >= int(ConstraintList.size())) {
+            return false;
+        }
+        // the constraint objects may have been replaced since the set up
+        Constraint* constraint = ConstraintList[it.index];
+        it.constr = constraint;
+        // the values of non-driving constraints are unknowns calculated by the solver
+        if (it.driving && it.value) {
+            double value = constraint->getValue();
+            if (constraint->Type == SnellsLaw) {
+                // same normalization as in addSnellsLawConstraint()
+                if (fabs(value) >= 1.0) {
+                    *it.secondvalue = value;
+                    *it.value = 1.0;
+                }
+                else {
+                    *it.secondvalue = 1.0;
+                    *it.value = 1 / value;
+                }
+            }
+            else {
+                *it.value = value;
+            }
+        }
+    }
+
+    // store the new reference configuration, the diagnosis of the system is kept
+    clearTemporaryConstraints();
+    GCSsys.initSolution(defaultSolverRedundant);
+
+    SetUpReused = true;
+    return true;
+}
+
 void Sketch::buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList)
 {
     for (auto* c : constraintList) {
@@ -2391,6 +2526,7 @@ int Sketch::addConstraints(const std::vector<Constraint*>& ConstraintList)
          it != ConstraintList.end();
          ++it, ++cid) {
         rtn = addConstraint(*it);
+        Constrs.back().index = cid;
 
         if (rtn == -1) {
             int humanconstraintid = cid + 1;
@@ -2414,6 +2550,7 @@ int Sketch::addConstraints(const std::vector<Constraint*>& ConstraintList,
          ++it, ++cid) {
         if (!unenforceableConstraints[cid] && (*it)->Type != Block && (*it)->isActive) {
             rtn = addConstraint(*it);
+            Constrs.back().index = cid;
 
             if (rtn == -1) {
                 int humanconstraintid = cid + 1;
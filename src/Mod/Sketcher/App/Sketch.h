@@ -77,6 +77,18 @@ public:
     int setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                     const std::vector<Constraint*>& ConstraintList,
                     int extGeoCount = 0);
+    /** update the datum values of the sketch set up by the last setUpSketch()
+     *
+     * This only succeeds if the geometry and the constraints, apart from the datum values of
+     * dimensional constraints, are the same as the ones of the current solver system. The
+     * solver system and its diagnosis (DoF, conflicting and redundant constraints) are then
+     * kept and only the datum parameters are updated.
+     *
+     * returns false if the sketch must be set up again with setUpSketch()
+     */
+    bool updateDatums(const std::vector<Part::Geometry*>& GeoList,
+                      const std::vector<Constraint*>& ConstraintList,
+                      int extGeoCount = 0);
     /// return the actual geometry of the sketch a TopoShape
     Part::TopoShape toShape() const;
     /// add unspecified geometry
@@ -137,6 +149,12 @@ public:
         return SolveTime;
     }
 
+    /// returns true if the last set up of the sketch reused the solver system (see updateDatums())
+    inline bool isSetUpReused() const
+    {
+        return SetUpReused;
+    }
+
     inline bool hasMalformedConstraints() const
     {
         return !MalformedConstraints.empty();
@@ -559,15 +577,39 @@ protected:
             , driving(true)
             , value(nullptr)
             , secondvalue(nullptr)
+            , index(-1)
         {}
         Constraint* constr;  // pointer to the constraint
         bool driving;
         double* value;
         double* secondvalue;  // this is needed for SnellsLaw
+        int index;            // index in the constraint list passed to addConstraints()
     };
 
     std::vector<GeoDef> Geoms;
     std::vector<ConstrDef> Constrs;
+    /// the constraint data the solver system depends on, apart from the datum values
+    struct ConstrTopology
+    {
+        ConstraintType type;
+        InternalAlignmentType alignmentType;
+        int first;
+        PointPos firstPos;
+        int second;
+        PointPos secondPos;
+        int third;
+        PointPos thirdPos;
+        bool driving;
+        bool active;
+        int internalAlignmentIndex;
+        // only compared for constraints whose value is not a plain datum parameter
+        double value;
+
+        bool operator==(const ConstrTopology& other) const;
+    };
+    std::vector<ConstrTopology> SetUpConstrs;
+    int SetUpExtGeoCount;
+    bool SetUpReused;
     GCS::System GCSsys;
     int ConstraintsCounter;
     std::vector<int> Conflicting;
@@ -719,6 +761,11 @@ private:
     bool updateGeometry();
     bool updateNonDrivingConstraints();
 
+    static ConstrTopology getConstrTopology(const Constraint* constraint);
+    /// returns true if the solver parameter of the datum is the plain constraint value
+    static bool isDatumParameter(const Constraint* constraint);
+    bool isSameGeometry(const std::vector<Part::Geometry*>& GeoList, int extGeoCount) const;
+
     void calculateDependentParametersElements();
 
     void clearTemporaryConstraints();
@@ -344,8 +344,15 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     // happened therefore we update our sketch solver geometry with the SketchObject one.
     //
     // set up a sketch (including dofs counting and diagnosing of conflicts)
-    lastDoF = solvedSketch.setUpSketch(
-        getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
+    //
+    // If only datum values changed since the last set up (e.g. a dimension driven by an
+    // expression), the solver system and its diagnosis are reused and lastDoF stays valid.
+    std::vector<Part::Geometry*> completeGeometry = getCompleteGeometry();
+    if (!solvedSketch.updateDatums(
+            completeGeometry, Constraints.getValues(), getExternalGeometryCount())) {
+        lastDoF = solvedSketch.setUpSketch(
+            completeGeometry, Constraints.getValues(), getExternalGeometryCount());
+    }
 
     // At this point we have the solver information about conflicting/redundant/over-constrained,
     // but the sketch is NOT solved. Some examples: Redundant: a vertical line, a horizontal line
@@ -7526,6 +7533,10 @@ void SketchObject::rebuildExternalGeometry()
     GeometryFacade::setConstruction(VLine, true);
     ExternalGeo.push_back(HLine);
     ExternalGeo.push_back(VLine);
+
+    // only the projections of the current references are kept
+    decltype(externalProjections) projections;
+
     for (int i = 0; i < int(Objects.size()); i++) {
         const App::DocumentObject* Obj = Objects[i];
         const std::string SubElement = SubElements[i];
@@ -7567,6 +7578,22 @@ void SketchObject::rebuildExternalGeometry()
                 "Datum feature type is not yet supported as external geometry for a sketch");
         }
 
+        // The projection only depends on the referenced shape and the sketch placement, so it
+        // is reused if the shape is still the same (unchanged TShape, location and orientation)
+        auto key = std::make_pair(Obj, SubElement);
+        auto cached = externalProjections.find(key);
+        if (cached != externalProjections.end() && cached->second.source.IsEqual(refSubShape)
+            && cached->second.placement == Plm) {
+            for (const auto& geo : cached->second.geometries) {
+                ExternalGeo.push_back(geo->copy());
+            }
+            projections[key] = std::move(cached->second);
+            ++externalProjectionStats.hits;
+            continue;
+        }
+        ++externalProjectionStats.misses;
+        std::size_t firstProjected = ExternalGeo.size();
+
         switch (refSubShape.ShapeType()) {
             case TopAbs_FACE: {
                 const TopoDS_Face& face = TopoDS::Face(refSubShape);
@@ -8110,8 +8137,18 @@ void SketchObject::rebuildExternalGeometry()
                 throw Base::TypeError("Unknown type of geometry");
                 break;
         }
+
+        ExternalProjection projection;
+        projection.source = refSubShape;
+        projection.placement = Plm;
+        for (std::size_t j = firstProjected; j < ExternalGeo.size(); j++) {
+            projection.geometries.emplace_back(ExternalGeo[j]->copy());
+        }
+        projections[key] = std::move(projection);
     }
 
+    externalProjections = std::move(projections);
+
     rebuildVertexIndex();
 }
 
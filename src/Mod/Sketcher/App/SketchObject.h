@@ -573,6 +573,18 @@ public:
         return lastMalformedConstraints;
     }
 
+    /// statistics of the cached projections of the external geometry
+    struct ExternalGeometryCacheStats
+    {
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+    /// gets the statistics of the projections done by rebuildExternalGeometry()
+    inline const ExternalGeometryCacheStats& getExternalGeometryCacheStats() const
+    {
+        return externalProjectionStats;
+    }
+
 public: /* Solver exposed interface */
     /// gets the solved sketch as a reference
     inline const Sketch& getSolvedSketch() const
@@ -836,6 +848,18 @@ private:
 
     std::vector<Part::Geometry*> ExternalGeo;
 
+    /// projection of an external reference, reused while neither the referenced shape nor
+    /// the placement of the sketch change
+    struct ExternalProjection
+    {
+        TopoDS_Shape source;
+        Base::Placement placement;
+        std::vector<std::unique_ptr<Part::Geometry>> geometries;
+    };
+    std::map<std::pair<const App::DocumentObject*, std::string>, ExternalProjection>
+        externalProjections;
+    ExternalGeometryCacheStats externalProjectionStats;
+
     std::vector<int> VertexId2GeoId;
     std::vector<PointPos> VertexId2PosId;
 
@@ -2389,6 +2389,17 @@ Py::List SketchObjectPy::getMalformedConstraints() const
     return malformed;
 }
 
+Py::Dict SketchObjectPy::getExternalGeometryCacheStats() const
+{
+    const auto& stats = this->getSketchObjectPtr()->getExternalGeometryCacheStats();
+
+    Py::Dict dict;
+    dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+    dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+
+    return dict;
+}
+
 PyObject* SketchObjectPy::getCustomAttributes(const char* /*attr*/) const
 {
     return nullptr;
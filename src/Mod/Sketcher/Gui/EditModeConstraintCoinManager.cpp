@@ -1889,6 +1889,7 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes(const GeoListFacade&
     Gui::coinRemoveAllChildren(editModeScenegraphNodes.constrGroup);
 
     vConstrType.clear();
+    uploadedConstrIcons.clear();
 
     // Get sketch normal
     Base::Vector3d RN(0, 0, 1);
@@ -2581,12 +2582,15 @@ void EditModeConstraintCoinManager::combineConstraintIcons(IconQueue iconQueue)
 
 void EditModeConstraintCoinManager::drawMergedConstraintIcons(IconQueue iconQueue)
 {
+    SoImage* thisDest = iconQueue[0].destination;
     for (IconQueue::iterator i = iconQueue.begin(); i != iconQueue.end(); ++i) {
-        clearCoinImage(i->destination);
+        // the destination of the composite icon is overwritten below anyway
+        if (i->destination != thisDest) {
+            clearCoinImage(i->destination);
+        }
     }
 
     QImage compositeIcon;
-    SoImage* thisDest = iconQueue[0].destination;
     SoInfo* thisInfo = iconQueue[0].infoPtr;
 
     // Tracks all constraint IDs that are combined into this icon
@@ -2734,6 +2738,34 @@ QImage EditModeConstraintCoinManager::renderConstrIcon(const QString& type,
     // Constants to help create constraint icons
     QString joinStr = QString::fromLatin1(", ");
 
+    QFont font = ViewProviderSketchCoinAttorney::getApplicationFont(viewProvider);
+    font.setPixelSize(static_cast<int>(1.0 * drawingParameters.constraintIconSize));
+    font.setBold(true);
+
+    // Most icons only differ in position, so the rendered images are reused
+    QString key = type + QLatin1Char('|') + QString::number(drawingParameters.constraintIconSize)
+        + QLatin1Char('|') + QString::number(iconRotation) + QLatin1Char('|')
+        + iconColor.name(QColor::HexArgb) + QLatin1Char('|') + font.key();
+    for (const auto& label : labels) {
+        key += QLatin1Char('|') + label;
+    }
+    for (const auto& color : labelColors) {
+        key += QLatin1Char('|') + color.name(QColor::HexArgb);
+    }
+
+    auto cached = constrIconCache.find(key);
+    if (cached != constrIconCache.end()) {
+        if (boundingBoxes) {
+            boundingBoxes->insert(boundingBoxes->end(),
+                                  cached->second.boundingBoxes.begin(),
+                                  cached->second.boundingBoxes.end());
+        }
+        if (vPad) {
+            *vPad = cached->second.vPad;
+        }
+        return cached->second.image;
+    }
+
     QPixmap pxMap;
     std::stringstream constraintName;
     constraintName << type.toLatin1().data()
@@ -2747,19 +2779,12 @@ QImage EditModeConstraintCoinManager::renderConstrIcon(const QString& type,
     }
     QImage icon = pxMap.toImage();
 
-    QFont font = ViewProviderSketchCoinAttorney::getApplicationFont(viewProvider);
-    font.setPixelSize(static_cast<int>(1.0 * drawingParameters.constraintIconSize));
-    font.setBold(true);
     QFontMetrics qfm = QFontMetrics(font);
 
     int labelWidth = qfm.boundingRect(labels.join(joinStr)).width();
     // See Qt docs on qRect::bottom() for explanation of the +1
     int pxBelowBase = qfm.boundingRect(labels.join(joinStr)).bottom() + 1;
 
-    if (vPad) {
-        *vPad = pxBelowBase;
-    }
-
     QTransform rotation;
     rotation.rotate(iconRotation);
 
@@ -2767,9 +2792,8 @@ QImage EditModeConstraintCoinManager::renderConstrIcon(const QString& type,
     QImage image = roticon.copy(0, 0, roticon.width() + labelWidth, roticon.height() + pxBelowBase);
 
     // Make a bounding box for the icon
-    if (boundingBoxes) {
-        boundingBoxes->push_back(QRect(0, 0, roticon.width(), roticon.height()));
-    }
+    std::vector<QRect> iconBoxes;
+    iconBoxes.push_back(QRect(0, 0, roticon.width(), roticon.height()));
 
     // Render the Icons
     QPainter qp(&image);
@@ -2807,16 +2831,28 @@ QImage EditModeConstraintCoinManager::renderConstrIcon(const QString& type,
             //       icon.width() is ever very small (or removed).
             qp.drawText(icon.width() + cursorOffset, icon.height(), labelStr);
 
-            if (boundingBoxes) {
-                labelBB = qfm.boundingRect(labelStr);
-                labelBB.moveTo(icon.width() + cursorOffset,
-                               icon.height() - qfm.height() + pxBelowBase);
-                boundingBoxes->push_back(labelBB);
-            }
+            labelBB = qfm.boundingRect(labelStr);
+            labelBB.moveTo(icon.width() + cursorOffset, icon.height() - qfm.height() + pxBelowBase);
+            iconBoxes.push_back(labelBB);
 
             cursorOffset += Gui::QtTools::horizontalAdvance(qfm, labelStr);
         }
     }
+    qp.end();
+
+    if (boundingBoxes) {
+        boundingBoxes->insert(boundingBoxes->end(), iconBoxes.begin(), iconBoxes.end());
+    }
+    if (vPad) {
+        *vPad = pxBelowBase;
+    }
+
+    // keep the cache bounded, e.g. labels change while renaming constraints
+    const std::size_t maxCachedIcons = 4096;
+    if (constrIconCache.size() >= maxCachedIcons) {
+        constrIconCache.clear();
+    }
+    constrIconCache[key] = ConstrIconCacheEntry {image, std::move(iconBoxes), pxBelowBase};
 
     return image;
 }
@@ -2831,7 +2867,10 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
                                     QList<QColor>() << color,
                                     i.iconRotation);
 
-    i.infoPtr->string.setValue(QString::number(i.constraintId).toLatin1().data());
+    QByteArray idString = QString::number(i.constraintId).toLatin1();
+    if (i.infoPtr->string.getValue() != idString.constData()) {
+        i.infoPtr->string.setValue(idString.constData());
+    }
     sendConstraintIconToCoin(image, i.destination);
 }
 
@@ -2872,12 +2911,23 @@ QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constr
 void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon,
                                                              SoImage* soImagePtr)
 {
+    SbVec2s iconSize(icon.width(), icon.height());
+
+    // Uploading an icon makes Coin redraw, so skip it if the node already shows this image
+    SbVec2s shownSize;
+    int numComponents;
+    soImagePtr->image.getValue(shownSize, numComponents);
+    auto uploaded = uploadedConstrIcons.find(soImagePtr);
+    if (uploaded != uploadedConstrIcons.end() && uploaded->second == icon.cacheKey()
+        && shownSize == iconSize) {
+        return;
+    }
+    uploadedConstrIcons[soImagePtr] = icon.cacheKey();
+
     SoSFImage icondata = SoSFImage();
 
     Gui::BitmapFactory().convert(icon, icondata);
 
-    SbVec2s iconSize(icon.width(), icon.height());
-
     int four = 4;
     soImagePtr->image.setValue(iconSize, 4, icondata.getValue(iconSize, four));
 
@@ -2888,6 +2938,16 @@ void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon,
 
 void EditModeConstraintCoinManager::clearCoinImage(SoImage* soImagePtr)
 {
+    uploadedConstrIcons.erase(soImagePtr);
+
+    // avoid a redraw if there is nothing to clear
+    SbVec2s shownSize;
+    int numComponents;
+    soImagePtr->image.getValue(shownSize, numComponents);
+    if (shownSize[0] == 0 && shownSize[1] == 0) {
+        return;
+    }
+
     soImagePtr->setToDefaults();
 }
 
@@ -191,6 +191,21 @@ private:
 
     std::map<QString, ConstrIconBBVec> combinedConstrBoxes;
 
+    /// Rendered constraint icon together with the output of renderConstrIcon()
+    struct ConstrIconCacheEntry
+    {
+        QImage image;
+        std::vector<QRect> boundingBoxes;
+        int vPad;
+    };
+
+    /// Icons rendered by renderConstrIcon(), shared by all constraints of the sketch. The key
+    /// is made of the type, labels, colors, rotation and size of the icon.
+    std::map<QString, ConstrIconCacheEntry> constrIconCache;
+
+    /// QImage::cacheKey() of the icon last sent to each SoImage, to skip unchanged uploads
+    std::map<SoImage*, qint64> uploadedConstrIcons;
+
 
     /// Internal type used for drawing constraint icons
     struct constrIconQueueItem
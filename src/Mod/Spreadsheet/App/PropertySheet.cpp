@@ -23,7 +23,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <unordered_set>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/regex.hpp>
@@ -72,6 +74,7 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    evaluationGraphDirty = true;
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -1340,9 +1343,23 @@ bool PropertySheet::isHidden(CellAddress address) const
 
 void PropertySheet::addDependencies(CellAddress key)
 {
+    // If the same dependencies are added that have been removed before the
+    // evaluation graph stays valid.
+    bool checkUnchanged = !evaluationGraphDirty && lastRemovedKey == key;
+    evaluationGraphDirty = true;
+    lastRemovedKey = CellAddress();
+    std::set<std::string> removedDeps;
+    removedDeps.swap(lastRemovedDeps);
+    auto checkGraph = [&]() {
+        if (checkUnchanged && getDeps(key) == removedDeps) {
+            evaluationGraphDirty = false;
+        }
+    };
+
     Cell* cell = getValue(key);
 
     if (!cell) {
+        checkGraph();
         return;
     }
 
@@ -1351,6 +1368,7 @@ void PropertySheet::addDependencies(CellAddress key)
     const Expression* expression = cell->getExpression();
 
     if (!expression) {
+        checkGraph();
         return;
     }
 
@@ -1392,6 +1410,8 @@ void PropertySheet::addDependencies(CellAddress key)
             }
         }
     }
+
+    checkGraph();
 }
 
 /**
@@ -1408,6 +1428,16 @@ void PropertySheet::removeDependencies(CellAddress key)
 
     std::map<CellAddress, std::set<std::string>>::iterator i1 = cellToPropertyNameMap.find(key);
 
+    lastRemovedKey = CellAddress();
+    lastRemovedDeps.clear();
+    if (!evaluationGraphDirty) {
+        lastRemovedKey = key;
+        if (i1 != cellToPropertyNameMap.end()) {
+            lastRemovedDeps = i1->second;
+        }
+    }
+    evaluationGraphDirty = true;
+
     if (i1 != cellToPropertyNameMap.end()) {
         std::set<std::string>::const_iterator j = i1->second.begin();
 
@@ -1657,6 +1687,115 @@ const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
     }
 }
 
+/**
+ * Rebuild the dependency graph between the cells of this sheet and compute the
+ * evaluation level of each cell.
+ */
+
+void PropertySheet::buildEvaluationGraph()
+{
+    localDependants.clear();
+    evaluationLevel.clear();
+    evaluationGraphDirty = false;
+    evaluationGraphCyclic = false;
+
+    if (!owner) {
+        return;
+    }
+
+    // Cells of this sheet are stored with the full name of the sheet as prefix
+    std::string prefix = owner->getFullName() + ".";
+    for (auto it = propertyNameToCellMap.lower_bound(prefix);
+         it != propertyNameToCellMap.end() && boost::starts_with(it->first, prefix);
+         ++it) {
+        if (it->second.empty()) {
+            continue;
+        }
+        // aliases are also stored with their cell address
+        CellAddress address = stringToAddress(it->first.c_str() + prefix.size(), true);
+        if (!address.isValid()) {
+            continue;
+        }
+        auto& dependants = localDependants[address];
+        dependants.insert(dependants.end(), it->second.begin(), it->second.end());
+    }
+
+    std::unordered_map<CellAddress, int, CellAddressHash> inDegree;
+    for (auto& v : localDependants) {
+        std::sort(v.second.begin(), v.second.end());
+        v.second.erase(std::unique(v.second.begin(), v.second.end()), v.second.end());
+        inDegree.emplace(v.first, 0);
+        for (const auto& dep : v.second) {
+            ++inDegree[dep];
+        }
+    }
+
+    // Kahn's algorithm
+    std::vector<CellAddress> queue;
+    queue.reserve(inDegree.size());
+    for (const auto& v : inDegree) {
+        if (v.second == 0) {
+            queue.push_back(v.first);
+            evaluationLevel[v.first] = 0;
+        }
+    }
+
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+        CellAddress current = queue[i];
+        auto it = localDependants.find(current);
+        if (it == localDependants.end()) {
+            continue;
+        }
+        int level = evaluationLevel[current] + 1;
+        for (const auto& dep : it->second) {
+            int& depLevel = evaluationLevel[dep];
+            depLevel = std::max(depLevel, level);
+            if (--inDegree[dep] == 0) {
+                queue.push_back(dep);
+            }
+        }
+    }
+
+    evaluationGraphCyclic = queue.size() != inDegree.size();
+}
+
+bool PropertySheet::getEvaluationOrder(const std::set<CellAddress>& dirtyCells,
+                                       std::vector<CellAddress>& order)
+{
+    if (evaluationGraphDirty) {
+        buildEvaluationGraph();
+    }
+    if (evaluationGraphCyclic) {
+        return false;
+    }
+
+    order.assign(dirtyCells.begin(), dirtyCells.end());
+    std::unordered_set<CellAddress, CellAddressHash> visited(dirtyCells.begin(), dirtyCells.end());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        auto it = localDependants.find(order[i]);
+        if (it == localDependants.end()) {
+            continue;
+        }
+        for (const auto& dep : it->second) {
+            if (visited.insert(dep).second) {
+                order.push_back(dep);
+            }
+        }
+    }
+
+    auto getLevel = [this](const CellAddress& address) {
+        auto it = evaluationLevel.find(address);
+        return it == evaluationLevel.end() ? 0 : it->second;
+    };
+    std::sort(order.begin(), order.end(), [&](const CellAddress& a, const CellAddress& b) {
+        int levelA = getLevel(a);
+        int levelB = getLevel(b);
+        return levelA != levelB ? levelA < levelB : a < b;
+    });
+
+    return true;
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -24,6 +24,8 @@
 #define PROPERTYSHEET_H
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -194,6 +196,13 @@ public:
 
     void recomputeDependencies(App::CellAddress key);
 
+    /** Collect \a dirtyCells and all cells of this sheet depending on them in
+      * evaluation order. Returns false if the cells of the sheet have a cyclic
+      * dependency, in which case \a order is undefined.
+      */
+    bool getEvaluationOrder(const std::set<App::CellAddress>& dirtyCells,
+                            std::vector<App::CellAddress>& order);
+
     PyObject* getPyObject() override;
     void setPyObject(PyObject*) override;
 
@@ -315,6 +324,36 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*
+     * Dependency graph between the cells of this sheet. It is kept alive between
+     * recomputes and only rebuilt when the dependencies of a cell have changed.
+     */
+
+    struct CellAddressHash
+    {
+        std::size_t operator()(const App::CellAddress& address) const
+        {
+            return std::hash<int>()((address.row() << 16) | address.col());
+        }
+    };
+
+    void buildEvaluationGraph();
+
+    /*! Cells of this sheet depending on the cell given in key */
+    std::unordered_map<App::CellAddress, std::vector<App::CellAddress>, CellAddressHash>
+        localDependants;
+
+    /*! Length of the longest dependency chain leading to a cell */
+    std::unordered_map<App::CellAddress, int, CellAddressHash> evaluationLevel;
+
+    bool evaluationGraphDirty = true;
+    bool evaluationGraphCyclic = false;
+
+    /*! Dependencies removed by the last call of removeDependencies() to detect
+      unchanged dependencies when they are added again */
+    App::CellAddress lastRemovedKey;
+    std::set<std::string> lastRemovedDeps;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -750,6 +750,23 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
+        // Fast path for plain numbers which don't need to be evaluated
+        if (input && input->is<NumberExpression>()) {
+            auto number = static_cast<const NumberExpression*>(input);
+            long l;
+            if (!number->getUnit().isEmpty()) {
+                setQuantityProperty(key, number->getValue(), number->getUnit());
+            }
+            else if (number->isInteger(&l)) {
+                setIntegerProperty(key, l);
+            }
+            else {
+                setFloatProperty(key, number->getValue());
+            }
+            cellUpdated(key);
+            return;
+        }
+
         if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output.reset(input->eval());
@@ -1026,6 +1043,18 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
+    // Use the cached evaluation order of the sheet unless it has a cyclic dependency
+    // which is handled below to report the involved cells.
+    std::vector<CellAddress> evaluationOrder;
+    if (cells.getEvaluationOrder(dirtyCells, evaluationOrder)) {
+        FC_LOG("recomputing " << getFullName());
+        for (const auto& addr : evaluationOrder) {
+            FC_TRACE(addr.toString());
+            recomputeCell(addr);
+        }
+        dirtyCells.clear();
+    }
+
     DependencyList graph;
     std::map<CellAddress, Vertex> VertexList;
     std::map<Vertex, CellAddress> VertexIndexList;
@@ -1572,6 +1572,39 @@ class SpreadsheetCases(unittest.TestCase):
         self.assertLess(abs(sheet.F4.Value - -1.6971), 0.0001)
         self.assertEqual(sheet.F5, FreeCAD.Vector(1.72, 2.96, 4.2))
 
+    def testDependentCellsRecomputeOrder(self):
+        """Chained and diamond shaped cell dependencies are recomputed in order"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        sheet.set("A1", "1")
+        sheet.set("B1", "=A1 + 1")
+        sheet.set("C1", "=B1 * 2")
+        sheet.set("D1", "=B1 + C1")
+        sheet.set("E1", "=D1 - A1")
+        sheet.set("A2", "2.5mm")
+        sheet.set("B2", "=A2 * 2")
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 2)
+        self.assertEqual(sheet.C1, 4)
+        self.assertEqual(sheet.D1, 6)
+        self.assertEqual(sheet.E1, 5)
+        self.assertEqual(sheet.B2, Units.Quantity("5mm"))
+
+        sheet.set("A1", "10")
+        sheet.set("A2", "1mm")
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 11)
+        self.assertEqual(sheet.C1, 22)
+        self.assertEqual(sheet.D1, 33)
+        self.assertEqual(sheet.E1, 23)
+        self.assertEqual(sheet.B2, Units.Quantity("2mm"))
+
+        # Changing a formula must update the cached dependency graph
+        sheet.set("C1", "=A1 * 3")
+        self.doc.recompute()
+        self.assertEqual(sheet.C1, 30)
+        self.assertEqual(sheet.D1, 41)
+        self.assertEqual(sheet.E1, 31)
+
     def tearDown(self):
         # closing doc
         FreeCAD.closeDocument(self.doc.Name)
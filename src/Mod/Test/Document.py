@@ -1967,6 +1967,33 @@ class DocumentObserverCases(unittest.TestCase):
         self.assertEqual(self.Obs.parameter2.pop(), self.Doc1.FileName)
         FreeCAD.closeDocument(self.Doc1.Name)
 
+    def testNotificationBatch(self):
+        class BatchObserver:
+            def __init__(self):
+                self.changes = []
+
+            def slotBatchedChangedObject(self, obj, prop):
+                if prop == "Value":
+                    self.changes.append(obj.Value)
+
+        self.Doc1 = FreeCAD.newDocument("Observer1")
+        obj = self.Doc1.addObject("App::FeaturePython", "Obj")
+        obj.addProperty("App::PropertyFloat", "Value")
+        batchObs = BatchObserver()
+        FreeCAD.addDocumentObserver(batchObs)
+        self.Obs.clear()
+        with FreeCAD.NotificationBatch():
+            for i in range(10):
+                obj.Value = i
+            self.assertEqual(self.Obs.signal.count("ObjChanged"), 10)
+            self.assertEqual(batchObs.changes, [])
+        self.assertEqual(batchObs.changes, [9.0])
+        obj.Value = 10
+        self.assertEqual(batchObs.changes, [9.0, 10.0])
+        FreeCAD.removeDocumentObserver(batchObs)
+        self.assertRaises(RuntimeError, FreeCAD.endNotificationBatch)
+        FreeCAD.closeDocument(self.Doc1.Name)
+
     def testDocument(self):
         # in case another document already exists then the tests cannot
         # be done reliably
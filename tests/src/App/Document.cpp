@@ -2,9 +2,15 @@
 
 #include "gtest/gtest.h"
 #include <gmock/gmock.h>
+#include <chrono>
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObject.h"
+#include "App/GroupExtension.h"
+#include "App/Link.h"
+#include "App/NotificationBatch.h"
+#include "App/Part.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +100,195 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, getUniqueObjectNameUsesHighestSuffix)
+{
+    // Arrange
+    doc()->addObject("App::VarSet", "Box");
+    doc()->addObject("App::VarSet", "Box");
+    auto obj = doc()->addObject("App::VarSet", "Box");
+    doc()->addObject("App::VarSet", "Box005");
+
+    // Act
+    doc()->removeObject(obj->getNameInDocument());
+    auto name = doc()->getUniqueObjectName("Box");
+
+    // Assert
+    EXPECT_EQ(name, "Box006");
+    EXPECT_EQ(doc()->getUniqueObjectName("Other"), "Other");
+}
+
+TEST_F(DocumentTest, uniqueLabelIgnoresOwnLabel)
+{
+    // Arrange
+    auto obj1 = doc()->addObject("App::VarSet", "A");
+    auto obj2 = doc()->addObject("App::VarSet", "B");
+    auto obj3 = doc()->addObject("App::VarSet", "C");
+    obj1->Label.setValue("Part");
+    obj2->Label.setValue("Part");
+    obj3->Label.setValue("Part");
+    EXPECT_STREQ(obj2->Label.getValue(), "Part001");
+    EXPECT_STREQ(obj3->Label.getValue(), "Part002");
+
+    // Act
+    obj2->Label.setValue("Other");
+    obj3->Label.setValue("Part");
+
+    // Assert
+    EXPECT_STREQ(obj3->Label.getValue(), "Part001");
+    EXPECT_EQ(doc()->getStandardObjectName("Part", 3), "Part002");
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST_F(DocumentTest, DISABLED_benchmarkAddManyObjects)
+{
+    const int numObjects = 100000;
+    auto elapsedMs = [](auto start) {
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numObjects; i++) {
+        doc()->addObject("App::VarSet", "Object");
+    }
+    RecordProperty("AddObjectMs", elapsedMs(start));
+    EXPECT_NE(doc()->getObject("Object99999"), nullptr);
+
+    std::vector<std::string> names(numObjects, "Feature");
+    start = std::chrono::steady_clock::now();
+    auto objs = doc()->addObjects("App::VarSet", names);
+    RecordProperty("AddObjectsMs", elapsedMs(start));
+    ASSERT_EQ(objs.size(), names.size());
+    EXPECT_STREQ(objs.back()->getNameInDocument(), "Feature99999");
+    EXPECT_STREQ(objs.back()->Label.getValue(), "Feature99999");
+}
+
+TEST_F(DocumentTest, notificationBatchCoalescesChanges)
+{
+    // Arrange
+    auto obj1 = doc()->addObject("App::VarSet", "A");
+    auto obj2 = doc()->addObject("App::VarSet", "B");
+    auto obj3 = doc()->addObject("App::VarSet", "C");
+    std::vector<std::string> changes;
+    int immediateChanges = 0;
+    int batches = 0;
+    auto conn = App::GetApplication().signalBatchedChangedObject.connect(
+        [&changes](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&prop == &obj.Label) {
+                changes.push_back(obj.Label.getValue());
+            }
+        });
+    auto connImmediate = doc()->signalChangedObject.connect(
+        [&immediateChanges](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&prop == &obj.Label) {
+                ++immediateChanges;
+            }
+        });
+    auto connBatch = App::GetApplication().signalAfterBatchedChanges.connect([&batches]() {
+        ++batches;
+    });
+
+    // Act
+    {
+        App::NotificationBatch batch;
+        obj2->Label.setValue("First");
+        obj1->Label.setValue("Second");
+        {
+            App::NotificationBatch nested;
+            obj2->Label.setValue("Third");
+        }
+        obj3->Label.setValue("Removed");
+        doc()->removeObject(obj3->getNameInDocument());
+        EXPECT_TRUE(changes.empty());
+        EXPECT_EQ(immediateChanges, 4);
+    }
+    obj1->Label.setValue("Immediate");
+    conn.disconnect();
+    connImmediate.disconnect();
+    connBatch.disconnect();
+
+    // Assert
+    EXPECT_THAT(changes, ::testing::ElementsAre("Third", "Second", "Immediate"));
+    EXPECT_EQ(batches, 1);
+    EXPECT_FALSE(App::NotificationBatch::isActive());
+    EXPECT_FALSE(App::NotificationBatch::end());
+}
+
+TEST_F(DocumentTest, subObjectCacheMatchesGetSubObject)
+{
+    // Arrange
+    auto part1 = static_cast<App::Part*>(doc()->addObject("App::Part", "Part1"));
+    auto part2 = static_cast<App::Part*>(doc()->addObject("App::Part", "Part2"));
+    part1->getExtensionByType<App::GroupExtension>()->addObject(part2);
+    part1->Placement.setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    part2->Placement.setValue(Base::Placement(Base::Vector3d(0, 2, 0), Base::Rotation()));
+    Base::Matrix4D expected;
+    part1->getSubObject("Part2.", nullptr, &expected);
+    doc()->getSubObjectCacheStats(true);
+
+    // Act
+    Base::Matrix4D mat1;
+    auto sobj1 = part1->getSubObjectCached("Part2.", &mat1);
+    Base::Matrix4D mat2;
+    auto sobj2 = part1->getSubObjectCached("Part2.", &mat2);
+    auto stats = doc()->getSubObjectCacheStats(true);
+    part2->Placement.setValue(Base::Placement(Base::Vector3d(0, 0, 3), Base::Rotation()));
+    Base::Matrix4D mat3;
+    auto sobj3 = part1->getSubObjectCached("Part2.", &mat3);
+    auto statsChanged = doc()->getSubObjectCacheStats();
+
+    // Assert
+    EXPECT_EQ(sobj1, part2);
+    EXPECT_EQ(sobj2, part2);
+    EXPECT_EQ(sobj3, part2);
+    EXPECT_EQ(mat1, expected);
+    EXPECT_EQ(mat2, expected);
+    EXPECT_EQ(mat3.getCol(3), Base::Vector3d(1, 0, 3));
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(statsChanged.hits, 0);
+    EXPECT_EQ(statsChanged.misses, 1);
+    EXPECT_EQ(part1->getSubObjectCached("Invalid."), nullptr);
+}
+
+TEST_F(DocumentTest, subObjectCacheFollowsLinkChanges)
+{
+    // Arrange
+    auto part = static_cast<App::Part*>(doc()->addObject("App::Part", "Part"));
+    auto child = static_cast<App::Part*>(doc()->addObject("App::Part", "Child"));
+    part->getExtensionByType<App::GroupExtension>()->addObject(child);
+    part->Placement.setValue(Base::Placement(Base::Vector3d(1, 0, 0), Base::Rotation()));
+    child->Placement.setValue(Base::Placement(Base::Vector3d(0, 2, 0), Base::Rotation()));
+    child->Label.setValue("ChildLabel");
+    auto link = static_cast<App::Link*>(doc()->addObject("App::Link", "Link"));
+    link->setLink(-1, part);
+    link->LinkTransform.setValue(false);
+
+    // Act
+    Base::Matrix4D mat1;
+    auto sobj1 = link->getSubObjectCached("$ChildLabel.", &mat1);
+    doc()->getSubObjectCacheStats(true);
+    link->Label2.setValue("Unrelated");
+    auto sobj2 = link->getSubObjectCached("$ChildLabel.");
+    auto statsUnrelated = doc()->getSubObjectCacheStats();
+    link->LinkTransform.setValue(true);
+    Base::Matrix4D mat3;
+    auto sobj3 = link->getSubObjectCached("$ChildLabel.", &mat3);
+    child->Label.setValue("Renamed");
+    auto sobj4 = link->getSubObjectCached("$ChildLabel.");
+    auto sobj5 = link->getSubObjectCached("$Renamed.");
+
+    // Assert
+    EXPECT_EQ(sobj1, child);
+    EXPECT_EQ(sobj2, child);
+    EXPECT_EQ(statsUnrelated.hits, 1);
+    EXPECT_EQ(statsUnrelated.misses, 0);
+    EXPECT_EQ(mat1.getCol(3), Base::Vector3d(0, 2, 0));
+    EXPECT_EQ(sobj3, child);
+    EXPECT_EQ(mat3.getCol(3), Base::Vector3d(1, 2, 0));
+    EXPECT_EQ(sobj4, nullptr);
+    EXPECT_EQ(sobj5, child);
+}
+
 // NOLINTEND(readability-magic-numbers)
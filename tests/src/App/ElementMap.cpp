@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include "gtest/gtest.h"
+#include <chrono>
 
 #include <App/Application.h>
 #include <App/ElementMap.h>
@@ -553,4 +554,128 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+
+TEST_F(ElementMapTest, findMappedNameWithDifferentPostfixSplit)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::IndexedName element("Edge", 1);
+    Data::MappedName mappedName("Edge1;:M;FUS");
+    Data::MappedName splitName(Data::MappedName("Edge1"), ";:M;FUS");
+    ASSERT_EQ(mappedName, splitName);
+    elementMap.setElementName(element, mappedName, 0);
+
+    // Act
+    auto foundElement = elementMap.find(splitName);
+    // the same name is already mapped to Edge1, so it is renamed for Edge2
+    auto duplicateName = elementMap.setElementName(Data::IndexedName("Edge", 2), splitName, 0);
+
+    // Assert
+    EXPECT_EQ(foundElement, element);
+    EXPECT_NE(duplicateName, splitName);
+    EXPECT_EQ(elementMap.find(Data::IndexedName("Edge", 1)), mappedName);
+}
+
+TEST_F(ElementMapTest, getAllIsSortedByName)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    for (int i = 1; i <= 20; ++i) {
+        Data::IndexedName element("Face", i);
+        elementMap.setElementName(element, Data::MappedName("F" + std::to_string(21 - i)), 0);
+    }
+
+    // Act
+    auto all = elementMap.getAll();
+
+    // Assert
+    ASSERT_EQ(all.size(), 20);
+    for (std::size_t i = 1; i < all.size(); ++i) {
+        EXPECT_TRUE(all[i - 1].name < all[i].name);
+    }
+}
+
+TEST_F(ElementMapTest, eraseAndReinsertManyNames)
+{
+    // Arrange
+    const int count = 1000;
+    Data::ElementMap elementMap;
+    for (int i = 1; i <= count; ++i) {
+        elementMap.setElementName(Data::IndexedName("Edge", i),
+                                  Data::MappedName("E" + std::to_string(i)),
+                                  0);
+    }
+
+    // Act
+    // erase every second element and map the others to a second name
+    for (int i = 1; i <= count; i += 2) {
+        elementMap.erase(Data::IndexedName("Edge", i));
+    }
+    for (int i = 2; i <= count; i += 2) {
+        elementMap.setElementName(Data::IndexedName("Edge", i),
+                                  Data::MappedName("F" + std::to_string(i)),
+                                  0,
+                                  nullptr,
+                                  false);
+    }
+    // move a name to another element
+    elementMap.setElementName(Data::IndexedName("Edge", 1), Data::MappedName("E2"), 0, nullptr, true);
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), count);
+    EXPECT_EQ(elementMap.find(Data::MappedName("E2")), Data::IndexedName("Edge", 1));
+    EXPECT_EQ(elementMap.find(Data::MappedName("F2")), Data::IndexedName("Edge", 2));
+    EXPECT_FALSE(elementMap.find(Data::MappedName("E3")));
+    for (int i = 4; i <= count; i += 2) {
+        EXPECT_EQ(elementMap.find(Data::MappedName("E" + std::to_string(i))),
+                  Data::IndexedName("Edge", i));
+        EXPECT_EQ(elementMap.find(Data::MappedName("F" + std::to_string(i))),
+                  Data::IndexedName("Edge", i));
+    }
+    EXPECT_EQ(elementMap.getAll().size(), count);
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST_F(ElementMapTest, DISABLED_benchmarkBuildAndLookup)
+{
+    // Arrange
+    const int count = 200000;
+    std::vector<Data::MappedName> names;
+    names.reserve(count);
+    for (int i = 1; i <= count; ++i) {
+        Data::MappedName name(Data::IndexedName("Edge", i));
+        name += ";:H" + std::to_string(i % 97) + ";FUS";
+        names.push_back(name);
+    }
+
+    auto elapsedMs = [](auto start) {
+        auto end = std::chrono::steady_clock::now();
+        return static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    };
+
+    // Act
+    auto start = std::chrono::steady_clock::now();
+    Data::ElementMap elementMap;
+    for (int i = 1; i <= count; ++i) {
+        elementMap.setElementName(Data::IndexedName("Edge", i), names[i - 1], 0);
+    }
+    RecordProperty("BuildMs", elapsedMs(start));
+    start = std::chrono::steady_clock::now();
+    int found = 0;
+    for (int i = 1; i <= count; ++i) {
+        if (elementMap.find(names[i - 1]).getIndex() == i) {
+            ++found;
+        }
+        if (elementMap.find(Data::IndexedName("Edge", i))) {
+            ++found;
+        }
+    }
+    RecordProperty("LookupMs", elapsedMs(start));
+
+    // Assert
+    EXPECT_EQ(elementMap.size(), count);
+    EXPECT_EQ(found, 2 * count);
+    RecordProperty("BytesPerElement", static_cast<int>(elementMap.getMemSize() / count));
+}
 // NOLINTEND(readability-magic-numbers)
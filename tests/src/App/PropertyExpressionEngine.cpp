@@ -3,11 +3,14 @@
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
+#include "App/CompiledExpression.h"
 #include "App/Document.h"
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -90,4 +93,44 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, compiledExpressionMatchesInterpreter)
+{
+    auto factor = static_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "Factor"));
+    auto count = static_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "Count"));
+    factor->setValue(2.5); // NOLINT
+    count->setValue(3); // NOLINT
+    static_cast<App::PropertyLength*>(target_prop())->setValue(10.0); // NOLINT
+
+    const char* texts[] = {
+        "2 * 3",
+        "7 / 2",
+        "-(3 + 4)",
+        "1.5 m + 20 mm",
+        "this_length * 2",
+        "this_length / Count + 1 mm",
+        "Count * 2 - 1",
+        "Factor * Count",
+    };
+    for (auto text : texts) {
+        std::unique_ptr<App::Expression> expr(App::Expression::parse(this_obj(), text));
+        auto compiled = App::CompiledExpression::compile(expr.get());
+        ASSERT_TRUE(compiled) << text;
+        App::any value;
+        ASSERT_TRUE(compiled->eval(value)) << text;
+        auto expected = expr->getValueAsAny();
+        EXPECT_EQ(value.type(), expected.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(value, expected)) << text;
+    }
+
+    // Errors and unsupported expressions are left to the interpreter
+    std::unique_ptr<App::Expression> mismatch(App::Expression::parse(this_obj(), "1 mm + 1 s"));
+    auto compiled = App::CompiledExpression::compile(mismatch.get());
+    ASSERT_TRUE(compiled);
+    App::any value;
+    EXPECT_FALSE(compiled->eval(value));
+
+    std::unique_ptr<App::Expression> function(App::Expression::parse(this_obj(), "sin(Factor)"));
+    EXPECT_FALSE(App::CompiledExpression::compile(function.get()));
+}
+
 // clang-format on
@@ -11,9 +11,51 @@
 #include <array>
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <sstream>
+#include <vector>
 
 namespace fs = boost::filesystem;
 
+namespace
+{
+
+// Records the elements and the character data of the remaining document
+std::vector<std::string> readAll(Base::XMLReader& reader)
+{
+    std::vector<std::string> result;
+    while (reader.readNextElement() || !reader.isEndOfDocument()) {
+        std::string entry = std::to_string(reader.level()) + ' ' + reader.localName();
+        if (reader.isEndOfElement()) {
+            entry += " end";
+        }
+        else if (reader.hasAttribute("attr")) {
+            entry += ' ';
+            entry += reader.getAttribute("attr");
+        }
+        if (!reader.isEndOfElement() && reader.hasAttribute("text")) {
+            std::string text;
+            reader.beginCharStream() >> text;
+            reader.endCharStream();
+            entry += ' ' + text;
+        }
+        result.push_back(entry);
+    }
+    return result;
+}
+
+std::string createDocument(int count)
+{
+    std::string data = R"(<?xml version="1.0" encoding="UTF-8"?><document>)";
+    for (int i = 0; i < count; ++i) {
+        auto index = std::to_string(i);
+        data += "<group attr='" + index + "'><empty attr='e" + index + "'/>";
+        data += "<!-- comment --><data text='1'>Text" + index + "</data></group>\n";
+    }
+    return data + "</document>";
+}
+
+}  // namespace
+
 class ReaderTest: public ::testing::Test
 {
 protected:
@@ -292,3 +334,78 @@ TEST_F(ReaderTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("FreeCAD rocks! 🪨🪨🪨"), std::string(buffer.data()));
 }
+
+TEST_F(ReaderTest, concurrentParsingMatchesSerial)
+{
+    // Arrange
+    std::string data = createDocument(5000);
+    std::istringstream serialStream(data);
+    Base::XMLReader serial("serial.xml", serialStream);
+    std::istringstream concurrentStream(data);
+    Base::XMLReader concurrent("concurrent.xml", concurrentStream);
+
+    // Act
+    concurrent.startConcurrentParsing();
+    auto expected = readAll(serial);
+    auto result = readAll(concurrent);
+
+    // Assert
+    EXPECT_EQ(expected.size(), 4 * 5000 + 2);
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(ReaderTest, stopConcurrentParsingContinuesOnCallingThread)
+{
+    // Arrange
+    std::string data = createDocument(2000);
+    std::istringstream serialStream(data);
+    Base::XMLReader serial("serial.xml", serialStream);
+    std::istringstream concurrentStream(data);
+    Base::XMLReader concurrent("concurrent.xml", concurrentStream);
+    auto expected = readAll(serial);
+
+    // Act
+    concurrent.startConcurrentParsing();
+    concurrent.readElement("document");
+    concurrent.readElement("group");
+    concurrent.stopConcurrentParsing();
+    std::vector<std::string> result {"1 document", "2 group 0"};
+    auto rest = readAll(concurrent);
+    result.insert(result.end(), rest.begin(), rest.end());
+
+    // Assert
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(ReaderTest, concurrentParsingThrowsOnInvalidXML)
+{
+    // Arrange
+    std::istringstream stream(R"(<?xml version="1.0" encoding="UTF-8"?><document><a></b>)");
+    Base::XMLReader reader("invalid.xml", stream);
+    reader.startConcurrentParsing();
+    reader.readElement("document");
+
+    // Act & Assert
+    EXPECT_THROW(reader.readElement("c"), Base::XMLParseException);  // NOLINT
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST_F(ReaderTest, DISABLED_benchmarkSerialVsConcurrentParsing)
+{
+    std::string data = createDocument(200000);
+    for (bool parallel : {false, true}) {
+        std::istringstream stream(data);
+        Base::XMLReader reader("benchmark.xml", stream);
+        if (parallel) {
+            reader.startConcurrentParsing();
+        }
+        std::size_t count = 0;
+        while (reader.readNextElement() || !reader.isEndOfDocument()) {
+            if (!reader.isEndOfElement() && reader.hasAttribute("attr")) {
+                // simulate the work of restoring the element
+                count += std::string(reader.getAttribute("attr")).size();
+            }
+        }
+        EXPECT_GT(count, 0);
+    }
+}
@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+#include "src/App/InitApplication.h"
+#include <Mod/Inspection/App/InspectionFeature.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class InspectNominalTessellatedShapeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(InspectNominalTessellatedShapeTest, TestSignedDistanceOfSolid)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    Inspection::InspectNominalTessellatedShape nominal(box, 1.0F, 0.01, false);
+
+    // Act & Assert
+    // outside of a face
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(5, 5, 12)), 2.0F, 1e-5F);
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(-3, 5, 5)), 3.0F, 1e-5F);
+    // inside
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(5, 5, 8)), -2.0F, 1e-5F);
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(1, 5, 5)), -1.0F, 1e-5F);
+    // outside of an edge and a corner where the nearest point is shared by several triangles
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(12, 12, 5)), std::sqrt(8.0F), 1e-5F);
+    EXPECT_NEAR(nominal.getSignedDistance(Base::Vector3f(11, 11, 11)), std::sqrt(3.0F), 1e-5F);
+}
+
+TEST_F(InspectNominalTessellatedShapeTest, TestDeflection)
+{
+    // Arrange
+    const double deflection = 0.1;
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    Inspection::InspectNominalShape exact(cylinder, 1.0F);
+    Inspection::InspectNominalTessellatedShape approx(cylinder, 1.0F, deflection, false);
+    Inspection::InspectNominalTessellatedShape refined(cylinder, 1.0F, deflection, true);
+
+    for (int i = 0; i < 36; i++) {
+        double angle = i * M_PI / 18.0;
+        auto dirX = static_cast<float>(std::cos(angle));
+        auto dirY = static_cast<float>(std::sin(angle));
+        // far from the surface and the search radius, near the surface and near the search radius
+        for (float radius : {3.0F, 8.0F, 5.02F, 4.98F, 6.03F}) {
+            Base::Vector3f point(dirX * radius, dirY * radius, 5.0F);
+
+            // Act
+            float exactDist = exact.getDistance(point);
+            float approxDist = approx.getDistance(point);
+            float refinedDist = refined.getDistance(point);
+
+            // Assert
+            EXPECT_NEAR(approxDist, exactDist, deflection + 1e-4);
+            if (std::fabs(std::fabs(approxDist) - 1.0F) <= deflection) {
+                EXPECT_FLOAT_EQ(refinedDist, exactDist);
+            }
+            else {
+                EXPECT_FLOAT_EQ(refinedDist, approxDist);
+            }
+        }
+    }
+}
+
+TEST_F(InspectNominalTessellatedShapeTest, TestConcurrentRefinement)
+{
+    // Arrange
+    const double deflection = 0.1;
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    Inspection::InspectNominalShape exact(cylinder, 1.0F);
+    Inspection::InspectNominalTessellatedShape refined(cylinder, 1.0F, deflection, true);
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 360; i++) {
+        double angle = i * M_PI / 180.0;
+        points.emplace_back(static_cast<float>(std::cos(angle) * 5.97),
+                            static_cast<float>(std::sin(angle) * 5.97),
+                            5.0F);
+    }
+    std::vector<float> distances(points.size());
+
+    // Act
+    std::vector<std::thread> threads;
+    const std::size_t numThreads = 4;
+    for (std::size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (std::size_t i = t; i < points.size(); i += numThreads) {
+                distances[i] = refined.getDistance(points[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_FLOAT_EQ(distances[i], exact.getDistance(points[i]));
+    }
+}
+
+TEST_F(InspectNominalTessellatedShapeTest, TestShapeWithoutFaces)
+{
+    // Arrange
+    TopoDS_Shape edge = BRepBuilderAPI_MakeEdge(gp_Pnt(0, 0, 0), gp_Pnt(10, 0, 0)).Edge();
+    Inspection::InspectNominalTessellatedShape nominal(edge, 1.0F, 0.1, false);
+
+    // Act
+    float dist = nominal.getDistance(Base::Vector3f(5, 3, 0));
+
+    // Assert
+    EXPECT_NEAR(dist, 3.0F, 1e-5F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
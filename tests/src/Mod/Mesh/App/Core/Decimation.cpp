@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Creates a closed unit sphere with 2 * rings * (segments - 1) facets
+MeshCore::MeshKernel CreateSphere(int rings, int segments)
+{
+    const double pi = 3.14159265358979323846;
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 1.0F);
+    for (int i = 1; i < segments; i++) {
+        double theta = pi * i / segments;
+        for (int j = 0; j < rings; j++) {
+            double phi = 2.0 * pi * j / rings;
+            points.emplace_back(float(std::sin(theta) * std::cos(phi)),
+                                float(std::sin(theta) * std::sin(phi)),
+                                float(std::cos(theta)));
+        }
+    }
+    points.emplace_back(0.0F, 0.0F, -1.0F);
+
+    auto ring = [rings](int i, int j) {
+        return MeshCore::PointIndex(1 + (i - 1) * rings + (j % rings));
+    };
+    auto bottom = MeshCore::PointIndex(points.size() - 1);
+
+    MeshCore::MeshFacetArray facets;
+    for (int j = 0; j < rings; j++) {
+        facets.emplace_back(0, ring(1, j), ring(1, j + 1));
+        facets.emplace_back(bottom, ring(segments - 1, j + 1), ring(segments - 1, j));
+    }
+    for (int i = 1; i < segments - 1; i++) {
+        for (int j = 0; j < rings; j++) {
+            facets.emplace_back(ring(i, j), ring(i + 1, j), ring(i + 1, j + 1));
+            facets.emplace_back(ring(i, j), ring(i + 1, j + 1), ring(i, j + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+// Maximum distance of the mesh points to the unit sphere
+float MaxDeviation(const MeshCore::MeshKernel& kernel)
+{
+    float dev = 0.0F;
+    for (const auto& pnt : kernel.GetPoints()) {
+        dev = std::max(dev, std::fabs(pnt.Length() - 1.0F));
+    }
+    return dev;
+}
+
+}  // namespace
+
+TEST(MeshSimplifyTest, TestSerial)
+{
+    MeshCore::MeshKernel kernel = CreateSphere(100, 50);
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.simplify(1000);
+
+    EXPECT_LE(kernel.CountFacets(), 1000);
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+}
+
+TEST(MeshSimplifyTest, TestParallel)
+{
+    MeshCore::MeshKernel kernel = CreateSphere(500, 250);
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.setParallel(true);
+    simplify.simplify(10000);
+
+    EXPECT_LE(kernel.CountFacets(), 10000);
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+    EXPECT_TRUE(MeshCore::MeshEvalSolid(kernel).Evaluate());
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(MeshSimplifyTest, DISABLED_BenchmarkSerialVsParallel)
+{
+    // About 1,000,000 facets
+    const MeshCore::MeshKernel sphere = CreateSphere(1000, 500);
+    const int target = 50000;
+
+    for (bool parallel : {false, true}) {
+        MeshCore::MeshKernel kernel = sphere;
+        auto start = std::chrono::steady_clock::now();
+        MeshCore::MeshSimplify simplify(kernel);
+        simplify.setParallel(parallel);
+        simplify.simplify(target);
+        auto end = std::chrono::steady_clock::now();
+
+        std::string mode = parallel ? "Parallel" : "Serial";
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        RecordProperty(mode + "Ms", static_cast<int>(ms));
+        RecordProperty(mode + "Facets", static_cast<int>(kernel.CountFacets()));
+        // deviation from the input sphere in units of 1e-6
+        RecordProperty(mode + "MaxDeviation", static_cast<int>(MaxDeviation(kernel) * 1e6F));
+
+        EXPECT_LE(kernel.CountFacets(), target);
+        EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+        // the parallel mode must not noticeably reduce the quality
+        EXPECT_LT(MaxDeviation(kernel), 0.01F);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <QThreadPool>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Adds a planar grid of size x size quads with the given origin and axes
+void AddGrid(std::vector<MeshCore::MeshGeomFacet>& facets,
+             int size,
+             const Base::Vector3f& origin,
+             const Base::Vector3f& dirU,
+             const Base::Vector3f& dirV)
+{
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            Base::Vector3f p1 = origin + dirU * float(i) + dirV * float(j);
+            Base::Vector3f p2 = p1 + dirU;
+            Base::Vector3f p3 = p1 + dirU + dirV;
+            Base::Vector3f p4 = p1 + dirV;
+            facets.emplace_back(p1, p2, p3);
+            facets.emplace_back(p1, p3, p4);
+        }
+    }
+}
+
+// A horizontal grid with a vertical grid crossing it in the middle
+MeshCore::MeshKernel CreateCrossingGrids(int size)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    AddGrid(facets, size, Base::Vector3f(0, 0, 0), Base::Vector3f(1, 0, 0), Base::Vector3f(0, 1, 0));
+    float half = float(size) / 2.0F;
+    AddGrid(facets,
+            size,
+            Base::Vector3f(0.3F, 0.0F, 0.25F - half),
+            Base::Vector3f(0, 1, 0),
+            Base::Vector3f(0, 0, 1));
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    return kernel;
+}
+
+std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>>
+BruteForceIntersections(const MeshCore::MeshKernel& kernel)
+{
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    const MeshCore::MeshFacetArray& faces = kernel.GetFacets();
+    Base::Vector3f pt1, pt2;
+    for (MeshCore::FacetIndex i = 0; i < faces.size(); i++) {
+        MeshCore::MeshGeomFacet facet1 = kernel.GetFacet(i);
+        for (MeshCore::FacetIndex j = i + 1; j < faces.size(); j++) {
+            bool common = false;
+            for (auto p1 : faces[i]._aulPoints) {
+                for (auto p2 : faces[j]._aulPoints) {
+                    common = common || p1 == p2;
+                }
+            }
+            if (common) {
+                continue;
+            }
+            MeshCore::MeshGeomFacet facet2 = kernel.GetFacet(j);
+            if (!(facet1.GetBoundBox() && facet2.GetBoundBox())) {
+                continue;
+            }
+            if (facet1.IntersectWithFacet(facet2, pt1, pt2) == 2) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    return pairs;
+}
+
+}  // namespace
+
+TEST(MeshEvalSelfIntersectionTest, TestNoIntersection)
+{
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    AddGrid(facets, 10, Base::Vector3f(0, 0, 0), Base::Vector3f(1, 0, 0), Base::Vector3f(0, 1, 0));
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(MeshEvalSelfIntersectionTest, TestMatchesBruteForce)
+{
+    MeshCore::MeshKernel kernel = CreateCrossingGrids(12);
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+    eval.GetIntersections(pairs);
+    auto expected = BruteForceIntersections(kernel);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(pairs, expected);
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(MeshEvalSelfIntersectionTest, DISABLED_BenchmarkLargeMesh)
+{
+    // About 500,000 facets
+    MeshCore::MeshKernel kernel = CreateCrossingGrids(350);
+
+    auto findIntersections = [&kernel](int threads, long long& ms) {
+        // the check runs serially if the thread pool is limited to one thread
+        QThreadPool* pool = QThreadPool::globalInstance();
+        int maxThreads = pool->maxThreadCount();
+        if (threads > 0) {
+            pool->setMaxThreadCount(threads);
+        }
+        auto start = std::chrono::steady_clock::now();
+        MeshCore::MeshEvalSelfIntersection eval(kernel);
+        std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs;
+        eval.GetIntersections(pairs);
+        auto end = std::chrono::steady_clock::now();
+        pool->setMaxThreadCount(maxThreads);
+        ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        return pairs;
+    };
+
+    long long serialMs = 0;
+    long long parallelMs = 0;
+    auto serial = findIntersections(1, serialMs);
+    auto parallel = findIntersections(0, parallelMs);
+    RecordProperty("Facets", static_cast<int>(kernel.CountFacets()));
+    RecordProperty("SerialMs", static_cast<int>(serialMs));
+    RecordProperty("ParallelMs", static_cast<int>(parallelMs));
+
+    // the vertical grid cuts one column of quads of the horizontal grid
+    EXPECT_FALSE(parallel.empty());
+    EXPECT_EQ(serial, parallel);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
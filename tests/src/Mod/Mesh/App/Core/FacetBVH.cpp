@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cfloat>
+#include <random>
+#include <vector>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/FacetBVH.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class FacetBVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> pos(-10.0F, 10.0F);
+        std::uniform_real_distribution<float> offset(-0.5F, 0.5F);
+        for (int i = 0; i < 2000; i++) {
+            Base::Vector3f p(pos(gen), pos(gen), pos(gen));
+            facets.emplace_back(p,
+                                p + Base::Vector3f(offset(gen), offset(gen), offset(gen)),
+                                p + Base::Vector3f(offset(gen), offset(gen), offset(gen)));
+        }
+    }
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+};
+
+TEST_F(FacetBVHTest, TestEmpty)
+{
+    MeshCore::FacetBVH bvh(std::vector<MeshCore::MeshGeomFacet> {});
+    EXPECT_TRUE(bvh.IsEmpty());
+    float dist = bvh.Nearest(Base::Vector3f(), [](MeshCore::FacetIndex) {
+        return 0.0F;
+    });
+    EXPECT_EQ(dist, FLT_MAX);
+}
+
+TEST_F(FacetBVHTest, TestIntersect)
+{
+    // Arrange
+    MeshCore::FacetBVH bvh(facets);
+    Base::BoundBox3f box(-2.0F, -3.0F, -1.0F, 4.0F, 2.0F, 3.0F);
+
+    // Act
+    std::vector<MeshCore::FacetIndex> found;
+    bvh.Intersect(box, [&](MeshCore::FacetIndex index) {
+        if (facets[index].GetBoundBox() && box) {
+            found.push_back(index);
+        }
+    });
+
+    // Assert
+    std::vector<MeshCore::FacetIndex> expected;
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        if (facets[i].GetBoundBox() && box) {
+            expected.push_back(MeshCore::FacetIndex(i));
+        }
+    }
+    std::sort(found.begin(), found.end());
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(found, expected);
+}
+
+TEST_F(FacetBVHTest, TestNearestMatchesBruteForce)
+{
+    // Arrange
+    MeshCore::FacetBVH bvh(facets, 4);
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> pos(-12.0F, 12.0F);
+
+    for (int i = 0; i < 50; i++) {
+        Base::Vector3f point(pos(gen), pos(gen), pos(gen));
+
+        // Act
+        float dist = bvh.Nearest(point, [&](MeshCore::FacetIndex index) {
+            return facets[index].DistanceToPoint(point);
+        });
+
+        // Assert
+        float expected = FLT_MAX;
+        for (const auto& it : facets) {
+            expected = std::min(expected, it.DistanceToPoint(point));
+        }
+        EXPECT_FLOAT_EQ(dist, expected);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -88,4 +88,80 @@ TEST_F(KDTreeTest, TestKDTreeFindRange)
     tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
     EXPECT_EQ(index, result);
 }
+
+TEST_F(KDTreeTest, TestKDTreeFindRadius)
+{
+    MeshCore::MeshKDTree tree;
+    tree.AddPoints(GetPoints());
+
+    // the box of FindInRange contains all points, the sphere only the corner
+    std::vector<MeshCore::PointIndex> index;
+    tree.FindInRange(Base::Vector3f(0, 0, 0), 1.0F, index);
+    EXPECT_EQ(index.size(), 8);
+
+    index.clear();
+    std::vector<MeshCore::PointIndex> result = {0, 1, 2, 4};
+    tree.FindInRadius(Base::Vector3f(0, 0, 0), 1.0F, index);
+    EXPECT_EQ(index, result);
+}
+
+TEST_F(KDTreeTest, TestKDTreeBatchNearest)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+
+    std::vector<Base::Vector3f> query = {Base::Vector3f(0.9F, 0.1F, 0.1F),
+                                         Base::Vector3f(0.1F, 0.9F, 0.8F)};
+    std::vector<MeshCore::PointIndex> index;
+    std::vector<float> dist;
+    tree.FindNearest(query, 2, index, dist);
+
+    ASSERT_EQ(index.size(), 4);
+    EXPECT_EQ(index[0], 4);
+    EXPECT_EQ(index[2], 3);
+    EXPECT_LE(dist[0], dist[1]);
+    EXPECT_LE(dist[2], dist[3]);
+    EXPECT_FLOAT_EQ(dist[0], Base::Distance(query[0], Base::Vector3f(1, 0, 0)));
+
+    // more neighbours than points
+    tree.FindNearest(query, 10, index, dist);
+    EXPECT_EQ(index.size(), 20);
+    EXPECT_EQ(index[8], MeshCore::POINT_INDEX_MAX);
+}
+
+TEST_F(KDTreeTest, TestKDTreeBatchMatchesSingle)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            for (int k = 0; k < 20; k++) {
+                points.emplace_back(float(i) * 0.1F, float(j) * 0.1F, float(k) * 0.13F);
+            }
+        }
+    }
+    MeshCore::MeshKDTree tree(points);
+
+    std::vector<Base::Vector3f> query;
+    for (int i = 0; i < 5000; i++) {
+        query.emplace_back(float(i % 47) * 0.11F, float(i % 53) * 0.09F, float(i % 13) * 0.2F);
+    }
+
+    std::vector<MeshCore::PointIndex> index;
+    std::vector<float> dist;
+    tree.FindNearest(query, 1, index, dist);
+    std::vector<std::vector<MeshCore::PointIndex>> ranges;
+    tree.FindInRadius(query, 0.15F, ranges);
+
+    ASSERT_EQ(index.size(), query.size());
+    ASSERT_EQ(ranges.size(), query.size());
+    for (std::size_t i = 0; i < query.size(); i++) {
+        Base::Vector3f nor;
+        float d {};
+        tree.FindNearest(query[i], nor, d);
+        EXPECT_FLOAT_EQ(dist[i], d);
+
+        std::vector<MeshCore::PointIndex> range;
+        tree.FindInRadius(query[i], 0.15F, range);
+        EXPECT_EQ(ranges[i], range);
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
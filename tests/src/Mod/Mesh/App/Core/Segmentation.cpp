@@ -0,0 +1,142 @@
+#include "gtest/gtest.h"
+#include <memory>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Creates a grid of sizeX x sizeY quads, if folded the grid consists of flat and tilted
+// planar strips
+MeshCore::MeshKernel CreateGrid(int sizeX, int sizeY, bool folded)
+{
+    MeshCore::MeshPointArray points;
+    for (int i = 0; i <= sizeX; i++) {
+        for (int j = 0; j <= sizeY; j++) {
+            float z = folded ? float((j / 8) % 2) * float(j % 8) : 0.0F;
+            points.emplace_back(float(i), float(j), z);
+        }
+    }
+
+    auto index = [sizeY](int i, int j) {
+        return MeshCore::PointIndex(i * (sizeY + 1) + j);
+    };
+
+    MeshCore::MeshFacetArray facets;
+    for (int i = 0; i < sizeX; i++) {
+        for (int j = 0; j < sizeY; j++) {
+            facets.emplace_back(index(i, j), index(i + 1, j), index(i + 1, j + 1));
+            facets.emplace_back(index(i, j), index(i + 1, j + 1), index(i, j + 1));
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+// Creates a pseudo-random curvature with mostly flat and some curved areas
+std::vector<MeshCore::CurvatureInfo> CreateCurvature(const MeshCore::MeshKernel& kernel)
+{
+    std::vector<MeshCore::CurvatureInfo> curvature(kernel.CountPoints());
+    unsigned int seed = 12345;
+    for (auto& it : curvature) {
+        seed = seed * 1103515245U + 12345U;
+        float value = (seed >> 16) % 10 < 7 ? 0.0F : 1.0F;
+        it.fMaxCurvature = value;
+        it.fMinCurvature = value;
+    }
+    return curvature;
+}
+
+std::vector<MeshCore::MeshSurfaceSegmentPtr>
+CreateCurvatureSegments(const std::vector<MeshCore::CurvatureInfo>& curvature)
+{
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
+    segm.push_back(std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(curvature, 2, 0.1F));
+    segm.push_back(
+        std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(curvature, 2, 0.1F, 0.1F, 1.0F, 1.0F));
+    return segm;
+}
+
+void ExpectEqual(const std::vector<MeshCore::MeshSurfaceSegmentPtr>& segm1,
+                 const std::vector<MeshCore::MeshSurfaceSegmentPtr>& segm2)
+{
+    ASSERT_EQ(segm1.size(), segm2.size());
+    for (std::size_t i = 0; i < segm1.size(); i++) {
+        EXPECT_STREQ(segm1[i]->GetType(), segm2[i]->GetType());
+        EXPECT_EQ(segm1[i]->GetSegments(), segm2[i]->GetSegments());
+    }
+}
+
+}  // namespace
+
+TEST(MeshSegmentAlgorithmTest, TestCurvatureParallelMatchesSerial)
+{
+    MeshCore::MeshKernel kernel = CreateGrid(60, 60, false);
+    std::vector<MeshCore::CurvatureInfo> curvature = CreateCurvature(kernel);
+
+    auto serial = CreateCurvatureSegments(curvature);
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    finder.FindSegments(serial);
+
+    auto parallel = CreateCurvatureSegments(curvature);
+    finder.setParallel(true);
+    finder.FindSegments(parallel);
+
+    EXPECT_GT(serial[0]->GetSegments().size(), 1);
+    EXPECT_GT(serial[1]->GetSegments().size(), 1);
+    ExpectEqual(serial, parallel);
+}
+
+TEST(MeshSegmentAlgorithmTest, TestPlaneFitParallelMatchesSerial)
+{
+    MeshCore::MeshKernel kernel = CreateGrid(40, 64, true);
+
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> serial, parallel;
+    serial.push_back(std::make_shared<MeshCore::MeshDistanceGenericSurfaceFitSegment>(
+        new MeshCore::PlaneSurfaceFit,
+        kernel,
+        10,
+        0.01F));
+    parallel.push_back(std::make_shared<MeshCore::MeshDistanceGenericSurfaceFitSegment>(
+        new MeshCore::PlaneSurfaceFit,
+        kernel,
+        10,
+        0.01F));
+
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    finder.FindSegments(serial);
+    finder.setParallel(true);
+    finder.FindSegments(parallel);
+
+    // a flat, a rising and a falling strip per period of the fold
+    EXPECT_EQ(serial[0]->GetSegments().size(), 12);
+    ExpectEqual(serial, parallel);
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(MeshSegmentAlgorithmTest, DISABLED_BenchmarkSerialVsParallel)
+{
+    // About 1,000,000 facets
+    MeshCore::MeshKernel kernel = CreateGrid(1000, 500, false);
+    std::vector<MeshCore::CurvatureInfo> curvature = CreateCurvature(kernel);
+
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> reference;
+    for (bool parallel : {false, true}) {
+        auto segm = CreateCurvatureSegments(curvature);
+        MeshCore::MeshSegmentAlgorithm finder(kernel);
+        finder.setParallel(parallel);
+        finder.FindSegments(segm);
+        if (parallel) {
+            ExpectEqual(reference, segm);
+        }
+        else {
+            reference = segm;
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SmoothingTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // A noisy planar grid with 200 x 200 points
+        const int size = 200;
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                float z = 0.01F * float(((i * 7 + j * 13) % 11) - 5) / 5.0F;
+                points.emplace_back(float(i), float(j), z);
+            }
+        }
+
+        MeshCore::MeshFacetArray facets;
+        for (int i = 0; i + 1 < size; i++) {
+            for (int j = 0; j + 1 < size; j++) {
+                auto p = MeshCore::PointIndex(i * size + j);
+                facets.emplace_back(p, p + size, p + size + 1);
+                facets.emplace_back(p, p + size + 1, p + 1);
+            }
+        }
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    static float Noise(const MeshCore::MeshKernel& mesh)
+    {
+        double sum = 0.0;
+        for (const auto& pnt : mesh.GetPoints()) {
+            sum += double(pnt.z) * double(pnt.z);
+        }
+        return float(std::sqrt(sum / double(mesh.CountPoints())));
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(SmoothingTest, TestLaplaceReducesNoise)
+{
+    float before = Noise(kernel);
+    MeshCore::LaplaceSmoothing smooth(kernel);
+    smooth.Smooth(5);
+    EXPECT_LT(Noise(kernel), before);
+}
+
+TEST_F(SmoothingTest, TestResultIndependentOfThreads)
+{
+    MeshCore::MeshKernel serial = kernel;
+    MeshCore::MeshKernel parallel = kernel;
+
+    MeshCore::TaubinSmoothing smooth1(serial);
+    smooth1.SetThreadCount(1);
+    smooth1.Smooth(4);
+
+    MeshCore::TaubinSmoothing smooth2(parallel);
+    smooth2.SetThreadCount(4);
+    smooth2.Smooth(4);
+
+    EXPECT_EQ(serial.GetPoints(), parallel.GetPoints());
+}
+
+TEST_F(SmoothingTest, TestMedianFilterResultIndependentOfThreads)
+{
+    MeshCore::MeshKernel serial = kernel;
+    MeshCore::MeshKernel parallel = kernel;
+
+    MeshCore::MedianFilterSmoothing smooth1(serial);
+    smooth1.SetThreadCount(1);
+    smooth1.Smooth(2);
+
+    MeshCore::MedianFilterSmoothing smooth2(parallel);
+    smooth2.SetThreadCount(4);
+    smooth2.Smooth(2);
+
+    EXPECT_EQ(serial.GetPoints(), parallel.GetPoints());
+    EXPECT_LT(Noise(parallel), Noise(kernel));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
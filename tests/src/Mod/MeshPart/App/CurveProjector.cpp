@@ -0,0 +1,197 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Circ.hxx>
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/MeshPart/App/CurveProjector.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Creates a wavy height field of size x size quads
+MeshCore::MeshKernel CreateSurface(int size, float amplitude)
+{
+    auto height = [amplitude](int i, int j) {
+        return amplitude * std::sin(0.3F * float(i)) * std::cos(0.2F * float(j));
+    };
+
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            Base::Vector3f p1(float(i), float(j), height(i, j));
+            Base::Vector3f p2(float(i + 1), float(j), height(i + 1, j));
+            Base::Vector3f p3(float(i + 1), float(j + 1), height(i + 1, j + 1));
+            Base::Vector3f p4(float(i), float(j + 1), height(i, j + 1));
+            facets.emplace_back(p1, p2, p3);
+            facets.emplace_back(p1, p3, p4);
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    return kernel;
+}
+
+// Creates a compound of count x count circles at the given height
+TopoDS_Shape CreateCircles(int count, double spacing, double radius, double height)
+{
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < count; j++) {
+            gp_Pnt center(spacing * (i + 0.5), spacing * (j + 0.5), height);
+            gp_Circ circle(gp_Ax2(center, gp_Dir(0, 0, 1)), radius);
+            builder.Add(comp, BRepBuilderAPI_MakeEdge(circle).Edge());
+        }
+    }
+    return comp;
+}
+
+void ExpectEqual(const std::vector<MeshPart::MeshProjection::PolyLine>& polylines1,
+                 const std::vector<MeshPart::MeshProjection::PolyLine>& polylines2)
+{
+    ASSERT_EQ(polylines1.size(), polylines2.size());
+    for (std::size_t i = 0; i < polylines1.size(); i++) {
+        EXPECT_EQ(polylines1[i].points, polylines2[i].points);
+    }
+}
+
+}  // namespace
+
+TEST(MeshProjectionTest, TestProjectParallelMatchesSerial)
+{
+    MeshCore::MeshKernel kernel = CreateSurface(40, 1.0F);
+    TopoDS_Shape shape = CreateCircles(3, 13.0, 5.0, 5.0);
+    Base::Vector3f dir(0, 0, -1);
+
+    std::vector<MeshPart::MeshProjection::PolyLine> serial, parallel;
+    MeshPart::MeshProjection proj(kernel);
+    proj.setParallel(false);
+    proj.projectParallelToMesh(shape, dir, serial);
+    proj.setParallel(true);
+    proj.projectParallelToMesh(shape, dir, parallel);
+
+    EXPECT_EQ(serial.size(), 9);
+    for (const auto& it : serial) {
+        EXPECT_FALSE(it.points.empty());
+    }
+    ExpectEqual(serial, parallel);
+}
+
+TEST(MeshProjectionTest, TestProjectToMeshMatchesSerial)
+{
+    MeshCore::MeshKernel kernel = CreateSurface(40, 0.0F);
+
+    // a single edge uses the parallel search of the mesh edges, several edges are
+    // projected concurrently
+    for (int count : {1, 4}) {
+        TopoDS_Shape shape = CreateCircles(count, 40.0 / count, 4.0, 0.1);
+        std::vector<MeshPart::MeshProjection::PolyLine> serial, parallel;
+        MeshPart::MeshProjection proj(kernel);
+        proj.setParallel(false);
+        proj.projectToMesh(shape, 0.5F, serial);
+        proj.setParallel(true);
+        proj.projectToMesh(shape, 0.5F, parallel);
+
+        EXPECT_EQ(serial.size(), std::size_t(count * count));
+        for (const auto& it : serial) {
+            EXPECT_FALSE(it.points.empty());
+        }
+        ExpectEqual(serial, parallel);
+    }
+}
+
+TEST(MeshProjectionTest, TestProjectOnMeshMatchesSerial)
+{
+    MeshCore::MeshKernel kernel = CreateSurface(40, 1.0F);
+    Base::Vector3f dir(0, 0, -1);
+
+    // some of the points lie outside of the mesh
+    std::vector<Base::Vector3f> points;
+    for (int i = -5; i < 50; i++) {
+        for (int j = -5; j < 50; j++) {
+            points.emplace_back(0.9F * float(i) + 0.05F, 0.9F * float(j) + 0.05F, 5.0F);
+        }
+    }
+
+    std::vector<Base::Vector3f> serial, parallel;
+    MeshPart::MeshProjection proj(kernel);
+    proj.setParallel(false);
+    proj.projectOnMesh(points, dir, 0.0F, serial);
+    proj.setParallel(true);
+    proj.projectOnMesh(points, dir, 0.0F, parallel);
+
+    EXPECT_FALSE(serial.empty());
+    EXPECT_LT(serial.size(), points.size());
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST(MeshProjectionTest, TestGridFollowsMesh)
+{
+    MeshCore::MeshKernel kernel = CreateSurface(20, 0.0F);
+    Base::Vector3f dir(0, 0, -1);
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 10; i++) {
+        points.emplace_back(2.0F * float(i) + 0.5F, 0.5F, 5.0F);
+    }
+
+    MeshPart::MeshProjection proj(kernel);
+    std::vector<Base::Vector3f> before;
+    proj.projectOnMesh(points, dir, 0.0F, before);
+    EXPECT_EQ(before.size(), points.size());
+
+    // a different number of facets
+    kernel = CreateSurface(10, 0.0F);
+    std::vector<Base::Vector3f> resized;
+    proj.projectOnMesh(points, dir, 0.0F, resized);
+    EXPECT_EQ(resized.size(), 5);
+
+    // the same number of facets at a different position
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(5, 0, 0));
+    kernel.Transform(mat);
+    std::vector<Base::Vector3f> moved;
+    proj.projectOnMesh(points, dir, 0.0F, moved);
+    ASSERT_EQ(moved.size(), 5);
+    EXPECT_FLOAT_EQ(moved.front().x, 6.5F);
+    EXPECT_FLOAT_EQ(moved.back().x, 14.5F);
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(MeshProjectionTest, DISABLED_BenchmarkSerialVsParallel)
+{
+    // About 500,000 facets and 100 circles
+    MeshCore::MeshKernel kernel = CreateSurface(500, 5.0F);
+    TopoDS_Shape shape = CreateCircles(10, 50.0, 20.0, 20.0);
+    Base::Vector3f dir(0, 0, -1);
+
+    std::vector<MeshPart::MeshProjection::PolyLine> reference;
+    for (bool parallel : {false, true}) {
+        MeshPart::MeshProjection proj(kernel);
+        proj.setParallel(parallel);
+        std::vector<MeshPart::MeshProjection::PolyLine> polylines;
+        auto start = std::chrono::steady_clock::now();
+        proj.projectParallelToMesh(shape, dir, polylines);
+        auto end = std::chrono::steady_clock::now();
+
+        std::string mode = parallel ? "Parallel" : "Serial";
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        RecordProperty(mode + "Ms", static_cast<int>(ms));
+        if (parallel) {
+            ExpectEqual(reference, polylines);
+        }
+        else {
+            reference = polylines;
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
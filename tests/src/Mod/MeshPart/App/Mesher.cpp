@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Trsf.hxx>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Mesh.h>
+#include <Mod/MeshPart/App/Mesher.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Creates a compound of size x size boxes with a cylinder above each
+TopoDS_Shape CreateAssembly(int size)
+{
+    TopoDS_Compound comp;
+    BRep_Builder builder;
+    builder.MakeCompound(comp);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            gp_Trsf trsf;
+            trsf.SetTranslation(gp_Vec(20.0 * i, 20.0 * j, 0.0));
+            TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+            TopoDS_Shape cyl = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(5, 5, 12), gp_Dir(0, 0, 1)),
+                                                        4.0,
+                                                        10.0)
+                                   .Shape();
+            builder.Add(comp, BRepBuilderAPI_Transform(box, trsf).Shape());
+            builder.Add(comp, BRepBuilderAPI_Transform(cyl, trsf).Shape());
+        }
+    }
+    return comp;
+}
+
+std::unique_ptr<Mesh::MeshObject> CreateMesh(const TopoDS_Shape& shape, bool parallel)
+{
+    MeshPart::Mesher mesher(shape);
+    mesher.setMethod(MeshPart::Mesher::Standard);
+    mesher.setDeflection(0.01);
+    mesher.setSegments(true);
+    mesher.setParallel(parallel);
+    return std::unique_ptr<Mesh::MeshObject>(mesher.createMesh());
+}
+
+}  // namespace
+
+TEST(MesherTest, TestParallelIsWatertight)
+{
+    TopoDS_Shape shape = CreateAssembly(3);
+    auto mesh = CreateMesh(shape, true);
+
+    // six faces of the box and three faces of the cylinder per cell
+    EXPECT_EQ(mesh->countSegments(), 81);
+    EXPECT_TRUE(MeshCore::MeshEvalSolid(mesh->getKernel()).Evaluate());
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(mesh->getKernel()).Evaluate());
+}
+
+TEST(MesherTest, TestParallelMatchesSerial)
+{
+    TopoDS_Shape shape = CreateAssembly(4);
+    auto serial = CreateMesh(shape, false);
+    auto parallel = CreateMesh(shape, true);
+
+    ASSERT_EQ(serial->countPoints(), parallel->countPoints());
+    ASSERT_EQ(serial->countFacets(), parallel->countFacets());
+    const MeshCore::MeshPointArray& points1 = serial->getKernel().GetPoints();
+    const MeshCore::MeshPointArray& points2 = parallel->getKernel().GetPoints();
+    for (std::size_t i = 0; i < points1.size(); i++) {
+        EXPECT_EQ(points1[i].x, points2[i].x);
+        EXPECT_EQ(points1[i].y, points2[i].y);
+        EXPECT_EQ(points1[i].z, points2[i].z);
+    }
+    const MeshCore::MeshFacetArray& facets1 = serial->getKernel().GetFacets();
+    const MeshCore::MeshFacetArray& facets2 = parallel->getKernel().GetFacets();
+    for (std::size_t i = 0; i < facets1.size(); i++) {
+        EXPECT_EQ(facets1[i]._aulPoints[0], facets2[i]._aulPoints[0]);
+        EXPECT_EQ(facets1[i]._aulPoints[1], facets2[i]._aulPoints[1]);
+        EXPECT_EQ(facets1[i]._aulPoints[2], facets2[i]._aulPoints[2]);
+    }
+    EXPECT_EQ(serial->countSegments(), parallel->countSegments());
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(MesherTest, DISABLED_BenchmarkLargeAssembly)
+{
+    // 800 solids
+    TopoDS_Shape shape = CreateAssembly(20);
+
+    for (bool parallel : {false, true}) {
+        // the triangulation of the previous run is removed by the mesher
+        auto start = std::chrono::steady_clock::now();
+        auto mesh = CreateMesh(shape, parallel);
+        auto end = std::chrono::steady_clock::now();
+
+        std::string mode = parallel ? "Parallel" : "Serial";
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        RecordProperty(mode + "Ms", static_cast<int>(ms));
+        RecordProperty(mode + "Facets", static_cast<int>(mesh->countFacets()));
+        EXPECT_TRUE(MeshCore::MeshEvalSolid(mesh->getKernel()).Evaluate());
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
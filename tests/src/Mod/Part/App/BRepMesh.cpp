@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "gtest/gtest.h"
+#include <Mod/Part/App/BRepMesh.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// Two triangles sharing an edge. The shared points of the second domain differ
+// from the first ones by less than the tolerance.
+std::vector<Part::BRepMesh::Domain> CreateDomains()
+{
+    using Base::Vector3d;
+    const double delta = 1e-15;
+    Part::BRepMesh::Domain domain1;
+    domain1.points = {Vector3d(0, 0, 0), Vector3d(1, 0, 0), Vector3d(0, 1, 0)};
+    domain1.facets = {{0, 1, 2}};
+
+    // the first point is not referenced
+    Part::BRepMesh::Domain domain2;
+    domain2.points = {Vector3d(5, 5, 5),
+                      Vector3d(0, 1 + delta, 0),
+                      Vector3d(1 + delta, 0, 0),
+                      Vector3d(1, 1, 0)};
+    domain2.facets = {{2, 3, 1}};
+
+    // degenerated facet
+    Part::BRepMesh::Domain domain3;
+    domain3.points = {Vector3d(1, 1, 0), Vector3d(1, 1, 0), Vector3d(2, 2, 0)};
+    domain3.facets = {{0, 1, 2}};
+    return {domain1, domain2, domain3};
+}
+
+}  // namespace
+
+TEST(BRepMeshTest, testParallelMatchesSerial)
+{
+    // Arrange
+    std::vector<Part::BRepMesh::Domain> domains = CreateDomains();
+    Part::BRepMesh serial;
+    Part::BRepMesh parallel;
+    parallel.setParallel(true);
+    std::vector<Base::Vector3d> points1, points2;
+    std::vector<Part::BRepMesh::Facet> facets1, facets2;
+
+    // Act
+    serial.getFacesFromDomains(domains, points1, facets1);
+    parallel.getFacesFromDomains(domains, points2, facets2);
+
+    // Assert
+    ASSERT_EQ(points1.size(), 4);
+    ASSERT_EQ(points2.size(), points1.size());
+    for (std::size_t i = 0; i < points1.size(); i++) {
+        EXPECT_EQ(points1[i].x, points2[i].x);
+        EXPECT_EQ(points1[i].y, points2[i].y);
+        EXPECT_EQ(points1[i].z, points2[i].z);
+    }
+    ASSERT_EQ(facets1.size(), 2);
+    ASSERT_EQ(facets2.size(), facets1.size());
+    for (std::size_t i = 0; i < facets1.size(); i++) {
+        EXPECT_EQ(facets1[i].I1, facets2[i].I1);
+        EXPECT_EQ(facets1[i].I2, facets2[i].I2);
+        EXPECT_EQ(facets1[i].I3, facets2[i].I3);
+    }
+    EXPECT_EQ(serial.createSegments(), parallel.createSegments());
+}
+
+TEST(BRepMeshTest, testParallelKeepsFirstPoint)
+{
+    // Arrange
+    std::vector<Part::BRepMesh::Domain> domains = CreateDomains();
+    Part::BRepMesh mesh;
+    mesh.setParallel(true);
+    std::vector<Base::Vector3d> points;
+    std::vector<Part::BRepMesh::Facet> facets;
+
+    // Act
+    mesh.getFacesFromDomains(domains, points, facets);
+
+    // Assert
+    ASSERT_EQ(points.size(), 4);
+    EXPECT_EQ(points[1].x, 1.0);
+    EXPECT_EQ(points[2].y, 1.0);
+    ASSERT_EQ(facets.size(), 2);
+    EXPECT_EQ(facets[1].I1, 1);
+    EXPECT_EQ(facets[1].I2, 3);
+    EXPECT_EQ(facets[1].I3, 2);
+    std::vector<Part::BRepMesh::Segment> segments = mesh.createSegments();
+    ASSERT_EQ(segments.size(), 3);
+    EXPECT_EQ(segments[2].size(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
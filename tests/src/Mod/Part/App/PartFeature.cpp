@@ -4,6 +4,8 @@
 
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include <src/App/InitApplication.h>
+#include <App/Link.h>
+#include <App/NotificationBatch.h>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include "PartTestHelpers.h"
 
@@ -127,3 +129,102 @@ TEST_F(FeaturePartTest, create)
     // will have only 1 feature
     EXPECT_EQ(otherDoc->getObjects().size(), 1);
 }
+
+TEST_F(FeaturePartTest, shapeCacheInvalidatesDependents)
+{
+    // Arrange
+    auto link = dynamic_cast<App::Link*>(_doc->addObject("App::Link"));
+    link->setLink(-1, _boxes[0]);
+    _doc->recompute();
+    Feature::clearShapeCache();
+    Feature::getShapeCacheStats(true);
+
+    // Act
+    auto shape1 = Feature::getTopoShape(link);
+    auto stats1 = Feature::getShapeCacheStats();
+    auto shape2 = Feature::getTopoShape(link);
+    auto stats2 = Feature::getShapeCacheStats();
+    _boxes[0]->Length.setValue(_boxes[0]->Length.getValue() * 2);
+    _doc->recompute();
+    auto shape3 = Feature::getTopoShape(link);
+    auto stats3 = Feature::getShapeCacheStats();
+
+    // Assert
+    EXPECT_GT(stats1.entries, 0);
+    EXPECT_EQ(stats2.hits, stats1.hits + 1);
+    EXPECT_GT(stats3.misses, stats2.misses);
+    EXPECT_DOUBLE_EQ(getVolume(shape1.getShape()), getVolume(shape2.getShape()));
+    EXPECT_DOUBLE_EQ(getVolume(shape3.getShape()), getVolume(shape1.getShape()) * 2);
+}
+
+TEST_F(FeaturePartTest, shapeCacheInvalidatesIndirectDependents)
+{
+    // Arrange
+    auto link1 = dynamic_cast<App::Link*>(_doc->addObject("App::Link"));
+    link1->setLink(-1, _boxes[0]);
+    auto link2 = dynamic_cast<App::Link*>(_doc->addObject("App::Link"));
+    link2->setLink(-1, link1);
+    _doc->recompute();
+    Feature::clearShapeCache();
+    auto shape1 = Feature::getTopoShape(link2);
+
+    // Act
+    _boxes[0]->Length.setValue(_boxes[0]->Length.getValue() * 2);
+    _doc->recompute();
+    auto shape2 = Feature::getTopoShape(link2);
+
+    // Assert
+    EXPECT_DOUBLE_EQ(getVolume(shape2.getShape()), getVolume(shape1.getShape()) * 2);
+}
+
+TEST_F(FeaturePartTest, shapeCacheInvalidatedInsideNotificationBatch)
+{
+    // Arrange
+    auto link = dynamic_cast<App::Link*>(_doc->addObject("App::Link"));
+    link->setLink(-1, _boxes[0]);
+    _doc->recompute();
+    Feature::clearShapeCache();
+    auto shape1 = Feature::getTopoShape(link);
+
+    // Act
+    TopoShape shape2;
+    {
+        App::NotificationBatch batch;
+        _boxes[0]->Length.setValue(_boxes[0]->Length.getValue() * 2);
+        _doc->recompute();
+        shape2 = Feature::getTopoShape(link);
+    }
+
+    // Assert
+    EXPECT_DOUBLE_EQ(getVolume(shape2.getShape()), getVolume(shape1.getShape()) * 2);
+}
+
+TEST_F(FeaturePartTest, shapeCacheEvictsLeastRecentlyUsed)
+{
+    // Arrange
+    std::vector<App::Link*> links;
+    for (auto box : _boxes) {
+        auto link = dynamic_cast<App::Link*>(_doc->addObject("App::Link"));
+        link->setLink(-1, box);
+        links.push_back(link);
+    }
+    _doc->recompute();
+    Feature::clearShapeCache();
+    auto maxMemory = Feature::getShapeCacheStats().maxMemory;
+
+    // Act
+    Feature::getTopoShape(links[0]);
+    auto entrySize = Feature::getShapeCacheStats().memory;
+    Feature::setShapeCacheSize(entrySize * 2);
+    Feature::getShapeCacheStats(true);
+    for (auto link : links) {
+        Feature::getTopoShape(link);
+    }
+    auto stats = Feature::getShapeCacheStats();
+    Feature::setShapeCacheSize(maxMemory);
+
+    // Assert
+    EXPECT_GT(stats.evictions, 0);
+    EXPECT_LE(stats.memory, stats.maxMemory);
+    EXPECT_EQ(stats.maxMemory, entrySize * 2);
+}
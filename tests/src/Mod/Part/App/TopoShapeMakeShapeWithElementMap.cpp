@@ -19,9 +19,45 @@
 #include <TopoDS_CompSolid.hxx>
 #include <TopoDS_Compound.hxx>
 
+#include <chrono>
+#include <string>
+
 using namespace Part;
 using namespace Data;
 
+namespace
+{
+
+// A plate and a compound of count x count cubes standing on it
+std::pair<TopoShape, TopoShape> createPlateAndCubes(int count)
+{
+    TopoShape plate {BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, -1.0), 2.0 * count, 2.0 * count, 1.0)
+                         .Shape(),
+                     1L};
+    std::vector<TopoShape> cubes;
+    long tag = 3L;
+    for (int i = 0; i < count; ++i) {
+        for (int j = 0; j < count; ++j) {
+            gp_Pnt corner(2.0 * i + 0.5, 2.0 * j + 0.5, 0.0);
+            cubes.emplace_back(BRepPrimAPI_MakeBox(corner, 1.0, 1.0, 1.0).Shape(), tag++);
+        }
+    }
+    TopoShape compound {2L};
+    compound.makeElementCompound(cubes);
+    return {plate, compound};
+}
+
+TopoShape fuse(const TopoShape& plate, const TopoShape& cubes, bool parallel)
+{
+    TopoShape::setParallelElementMapping(parallel);
+    TopoShape result {10L};
+    result.makeElementBoolean(OpCodes::Fuse, {plate, cubes});
+    TopoShape::setParallelElementMapping(true);
+    return result;
+}
+
+}  // namespace
+
 class TopoShapeMakeShapeWithElementMapTests: public ::testing::Test
 {
 protected:
@@ -327,3 +363,42 @@ std::string composeTagInfo(const MappedElement& element, const TopoShape& shape)
 
     return tagInfo;
 }
+
+TEST_F(TopoShapeMakeShapeWithElementMapTests, parallelMappingMatchesSerial)
+{
+    // Arrange
+    auto [plate, cubes] = createPlateAndCubes(12);
+
+    // Act
+    TopoShape serial = fuse(plate, cubes, false);
+    TopoShape parallel = fuse(plate, cubes, true);
+
+    // Assert
+    EXPECT_EQ(serial.countSubElements("Face"), 6 + 12 * 12 * 5);
+    std::vector<std::string> names;
+    for (const auto& element : serial.getElementMap()) {
+        names.push_back(element.name.toString());
+    }
+    EXPECT_EQ(parallel.getElementMapSize(), serial.getElementMapSize());
+    EXPECT_TRUE(PartTestHelpers::allElementsMatch(parallel, names));
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST_F(TopoShapeMakeShapeWithElementMapTests, DISABLED_benchmarkSerialVsParallel)
+{
+    // Arrange
+    // About 10,000 faces
+    auto [plate, cubes] = createPlateAndCubes(45);
+
+    // Act and assert
+    for (bool parallel : {false, true}) {
+        auto start = std::chrono::steady_clock::now();
+        TopoShape result = fuse(plate, cubes, parallel);
+        auto end = std::chrono::steady_clock::now();
+
+        std::string mode = parallel ? "Parallel" : "Serial";
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        RecordProperty(mode + "Ms", static_cast<int>(ms));
+        EXPECT_EQ(result.countSubElements("Face"), 6 + 45 * 45 * 5);
+    }
+}
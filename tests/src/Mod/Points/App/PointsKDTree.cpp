@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <Mod/Points/App/PointsKDTree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsKDTreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+        for (int i = 0; i < 5000; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+    }
+
+    // Indices of all points sorted by their distance to p
+    std::vector<std::size_t> sortByDistance(const Base::Vector3f& p) const
+    {
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (!std::isnan(points[i].x)) {
+                indices.push_back(i);
+            }
+        }
+        std::sort(indices.begin(), indices.end(), [&](std::size_t a, std::size_t b) {
+            return Base::DistanceP2(points[a], p) < Base::DistanceP2(points[b], p);
+        });
+        return indices;
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointsKDTreeTest, TestFindNearest)
+{
+    Points::PointsKDTree tree(points);
+    EXPECT_EQ(tree.size(), points.size());
+
+    std::vector<std::size_t> indices;
+    std::vector<float> distances;
+    for (int i = 0; i < 10; i++) {
+        Base::Vector3f p(0.2F * float(i) - 1.0F, 0.1F, -0.3F);
+        tree.FindNearest(p, 8, indices, distances);
+        std::vector<std::size_t> expected = sortByDistance(p);
+        expected.resize(8);
+        EXPECT_EQ(indices, expected);
+        EXPECT_TRUE(std::is_sorted(distances.begin(), distances.end()));
+    }
+}
+
+TEST_F(PointsKDTreeTest, TestFindInRadius)
+{
+    Points::PointsKDTree tree(points);
+    Base::Vector3f p(0.1F, 0.2F, 0.3F);
+
+    std::vector<std::size_t> indices;
+    tree.FindInRadius(p, 0.25F, indices);
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (Base::Distance(points[i], p) <= 0.25F) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(indices, expected);
+}
+
+TEST_F(PointsKDTreeTest, TestSkipInvalid)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    points[0].Set(nan, nan, nan);
+    Points::PointsKDTree tree(points);
+    EXPECT_EQ(tree.size(), points.size() - 1);
+
+    std::vector<std::size_t> indices;
+    std::vector<float> distances;
+    tree.FindNearest(points[1], points.size(), indices, distances);
+    EXPECT_EQ(indices.size(), points.size() - 1);
+    EXPECT_EQ(indices.front(), 1);
+    EXPECT_EQ(std::count(indices.begin(), indices.end(), 0), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <random>
+#include <Base/Exception.h>
+#include <Base/Matrix.h>
+#include <Mod/Points/App/Processing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+
+// A noise-free grid of size x size points on the plane z = 0.5 * x + 2
+Points::PointKernel CreatePlane(int size, float spacing)
+{
+    Points::PointKernel kernel;
+    std::vector<Base::Vector3f>& points = kernel.getBasicPoints();
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            float x = float(i) * spacing;
+            float y = float(j) * spacing;
+            points.emplace_back(x, y, 0.5F * x + 2.0F);
+        }
+    }
+    return kernel;
+}
+
+}  // namespace
+
+TEST(PointsProcessingTest, TestNormalEstimation)
+{
+    Points::PointKernel kernel = CreatePlane(50, 0.1F);
+    Points::NormalEstimation estimate(kernel);
+    estimate.setKSearch(10);
+
+    std::vector<Base::Vector3f> normals;
+    estimate.perform(normals);
+    ASSERT_EQ(normals.size(), kernel.size());
+
+    // oriented towards the origin which lies below the plane
+    Base::Vector3f expected(0.5F, 0.0F, -1.0F);
+    expected.Normalize();
+    for (const auto& it : normals) {
+        EXPECT_NEAR(it * expected, 1.0F, 1e-4F);
+    }
+}
+
+TEST(PointsProcessingTest, TestNormalEstimationTransformed)
+{
+    Points::PointKernel kernel = CreatePlane(20, 0.1F);
+    Base::Matrix4D mat;
+    mat.rotZ(M_PI / 2.0);
+    mat.move(Base::Vector3d(0.0, 0.0, -10.0));
+    kernel.setTransform(mat);
+
+    Points::NormalEstimation estimate(kernel);
+    estimate.setKSearch(8);
+    std::vector<Base::Vector3f> normals;
+    estimate.perform(normals);
+
+    // the plane is now below the origin and rotated about the z-axis
+    Base::Vector3f expected(0.0F, -0.5F, 1.0F);
+    expected.Normalize();
+    for (const auto& it : normals) {
+        EXPECT_NEAR(it * expected, 1.0F, 1e-4F);
+    }
+}
+
+TEST(PointsProcessingTest, TestNormalEstimationInvalid)
+{
+    Points::PointKernel kernel = CreatePlane(10, 0.1F);
+    Points::NormalEstimation estimate(kernel);
+    estimate.setKSearch(0);
+    std::vector<Base::Vector3f> normals;
+    EXPECT_THROW(estimate.perform(normals), Base::ValueError);
+}
+
+TEST(PointsProcessingTest, TestOutlierRemoval)
+{
+    Points::PointKernel kernel = CreatePlane(30, 0.1F);
+    kernel.getBasicPoints().emplace_back(1.0F, 1.0F, 10.0F);
+    kernel.getBasicPoints().emplace_back(-5.0F, 1.0F, 0.0F);
+
+    Points::OutlierRemoval filter(kernel);
+    filter.setKSearch(10);
+    std::vector<unsigned long> inliers;
+    filter.perform(inliers);
+
+    EXPECT_EQ(inliers.size(), 900);
+    EXPECT_EQ(inliers.back(), 899);
+}
+
+TEST(PointsProcessingTest, TestVoxelGridFilter)
+{
+    Points::PointKernel kernel = CreatePlane(40, 0.1F);
+    Points::VoxelGridFilter filter(kernel);
+    filter.setLeafSize(1.0, 1.0, 100.0);
+
+    Points::PointKernel result;
+    filter.perform(result);
+
+    // 4 x 4 cells with 10 x 10 points each
+    EXPECT_EQ(result.size(), 16);
+    Base::Vector3d first = result.getPoint(0);
+    EXPECT_NEAR(first.x, 0.45, 1e-5);
+    EXPECT_NEAR(first.y, 0.45, 1e-5);
+    EXPECT_NEAR(first.z, 2.225, 1e-5);
+}
+
+// Only meant to be run manually with --gtest_also_run_disabled_tests
+TEST(PointsProcessingTest, DISABLED_BenchmarkNormalEstimation)
+{
+    // About 1,000,000 points with some noise
+    Points::PointKernel kernel = CreatePlane(1000, 0.01F);
+    std::mt19937 gen(0);
+    std::normal_distribution<float> noise(0.0F, 0.001F);
+    for (auto& it : kernel.getBasicPoints()) {
+        it.z += noise(gen);
+    }
+
+    Points::NormalEstimation estimate(kernel);
+    estimate.setKSearch(10);
+    std::vector<Base::Vector3f> normals;
+    estimate.perform(normals);
+
+    EXPECT_EQ(normals.size(), kernel.size());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
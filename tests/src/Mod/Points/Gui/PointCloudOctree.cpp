@@ -0,0 +1,176 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <limits>
+#include <Inventor/SbMatrix.h>
+#include <Inventor/SbViewVolume.h>
+#include <Mod/Points/Gui/PointCloudOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointCloudOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // 64 x 64 x 32 points in the box [0, 1] x [0, 1] x [-2, -1]
+        for (int i = 0; i < 64; i++) {
+            for (int j = 0; j < 64; j++) {
+                for (int k = 0; k < 32; k++) {
+                    points.emplace_back(float(i) / 63.0F,
+                                        float(j) / 63.0F,
+                                        -2.0F + float(k) / 31.0F);
+                }
+            }
+        }
+    }
+
+    // A parallel projection along the negative z axis onto the given range of x
+    static SbViewVolume makeView(float left, float right)
+    {
+        SbViewVolume vv;
+        vv.ortho(left, right, -0.1F, 1.1F, 0.5F, 3.0F);
+        return vv;
+    }
+
+    static uint32_t countPoints(const std::vector<std::pair<uint32_t, uint32_t>>& ranges)
+    {
+        uint32_t count = 0;
+        for (const auto& it : ranges) {
+            count += it.second;
+        }
+        return count;
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointCloudOctreeTest, TestBuild)
+{
+    // Arrange
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    points[5] = Base::Vector3f(nan, 0.0F, 0.0F);
+    PointsGui::PointCloudOctree octree;
+
+    // Act
+    octree.build(points);
+
+    // Assert
+    const auto& order = octree.getOrder();
+    const auto& leaves = octree.getLeaves();
+    EXPECT_EQ(order.size(), points.size() - 1);
+    std::vector<uint32_t> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(std::adjacent_find(sorted.begin(), sorted.end()), sorted.end());
+    EXPECT_FALSE(std::binary_search(sorted.begin(), sorted.end(), 5U));
+
+    // the leaves cover the order without gaps and contain their points
+    EXPECT_GT(leaves.size(), 1);
+    uint32_t next = 0;
+    for (const auto& leaf : leaves) {
+        EXPECT_EQ(leaf.first, next);
+        EXPECT_LE(leaf.count, PointsGui::PointCloudOctree::maxLeafSize);
+        for (uint32_t i = leaf.first; i < leaf.first + leaf.count; i++) {
+            const Base::Vector3f& p = points[order[i]];
+            EXPECT_TRUE(leaf.box.intersect(SbVec3f(p.x, p.y, p.z)));
+        }
+        next += leaf.count;
+    }
+    EXPECT_EQ(next, order.size());
+
+    SbVec3f min, max;
+    octree.getBoundBox().getBounds(min, max);
+    EXPECT_FLOAT_EQ(min[0], 0.0F);
+    EXPECT_FLOAT_EQ(max[2], -1.0F);
+}
+
+TEST_F(PointCloudOctreeTest, TestBuildEmpty)
+{
+    // Arrange
+    PointsGui::PointCloudOctree octree;
+
+    // Act
+    octree.build({});
+
+    // Assert
+    EXPECT_TRUE(octree.getOrder().empty());
+    EXPECT_TRUE(octree.getLeaves().empty());
+    EXPECT_TRUE(octree.getBoundBox().isEmpty());
+}
+
+TEST_F(PointCloudOctreeTest, TestSelectAllPoints)
+{
+    // Arrange
+    PointsGui::PointCloudOctree octree;
+    octree.build(points);
+    bool complete = false;
+
+    // Act
+    auto ranges = octree.selectPoints(makeView(-0.1F, 1.1F),
+                                      SbMatrix::identity(),
+                                      100000.0F,
+                                      points.size(),
+                                      complete);
+
+    // Assert
+    EXPECT_TRUE(complete);
+    EXPECT_EQ(ranges.size(), octree.getLeaves().size());
+    EXPECT_EQ(countPoints(ranges), points.size());
+}
+
+TEST_F(PointCloudOctreeTest, TestSelectWithBudget)
+{
+    // Arrange
+    PointsGui::PointCloudOctree octree;
+    octree.build(points);
+    const uint32_t budget = 10000;
+    bool complete = true;
+
+    // Act
+    auto ranges = octree.selectPoints(makeView(-0.1F, 1.1F),
+                                      SbMatrix::identity(),
+                                      100000.0F,
+                                      budget,
+                                      complete);
+
+    // Assert
+    EXPECT_FALSE(complete);
+    // every visible leaf gets a prefix of its points, rounding up may exceed the budget a bit
+    EXPECT_EQ(ranges.size(), octree.getLeaves().size());
+    EXPECT_LE(countPoints(ranges), budget + ranges.size());
+    EXPECT_GE(countPoints(ranges), budget);
+    for (std::size_t i = 0; i < ranges.size(); i++) {
+        EXPECT_EQ(ranges[i].first, octree.getLeaves()[i].first);
+        EXPECT_LE(ranges[i].second, octree.getLeaves()[i].count);
+    }
+}
+
+TEST_F(PointCloudOctreeTest, TestSelectVisibleLeaves)
+{
+    // Arrange
+    PointsGui::PointCloudOctree octree;
+    octree.build(points);
+    bool complete = false;
+
+    // Act
+    auto ranges = octree.selectPoints(makeView(-0.1F, 0.3F),
+                                      SbMatrix::identity(),
+                                      100000.0F,
+                                      points.size(),
+                                      complete);
+
+    // Assert
+    EXPECT_TRUE(complete);
+    EXPECT_FALSE(ranges.empty());
+    EXPECT_LT(ranges.size(), octree.getLeaves().size());
+    for (const auto& it : ranges) {
+        auto leaf = std::find_if(octree.getLeaves().begin(),
+                                 octree.getLeaves().end(),
+                                 [&it](const PointsGui::PointCloudOctree::Leaf& l) {
+                                     return l.first == it.first;
+                                 });
+        ASSERT_NE(leaf, octree.getLeaves().end());
+        EXPECT_LE(leaf->box.getMin()[0], 0.3F);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -8,6 +8,7 @@
 #include <App/Document.h>
 #include <App/Expression.h>
 #include <App/ObjectIdentifier.h>
+#include <Mod/Part/App/FeaturePartBox.h>
 #include <Mod/Sketcher/App/GeoEnum.h>
 #include <Mod/Sketcher/App/SketchObject.h>
 #include <src/App/InitApplication.h>
@@ -253,3 +254,103 @@ TEST_F(SketchObjectTest, testReverseAngleConstraintToSupplementaryExpressionAppl
     // Assert
     EXPECT_EQ(std::string("32 °"), getObject()->getConstraintExpression(id));
 }
+
+TEST_F(SketchObjectTest, testSetDatumReusesSolverSystem)
+{
+    // Arrange
+    Base::Vector3d p1(0.0, 0.0, 0.0), p2(1.0, 0.0, 0.0);
+    std::unique_ptr<Part::Geometry> geoline(new Part::GeomLineSegment());
+    static_cast<Part::GeomLineSegment*>(geoline.get())->setPoints(p1, p2);
+    int geoId = getObject()->addGeometry(geoline.get());
+    auto constraint = std::make_unique<Sketcher::Constraint>();
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->setValue(1.0);
+    auto id = getObject()->addConstraint(std::move(constraint));
+    getObject()->solve();
+
+    // Act
+    int err = getObject()->setDatum(id, 2.0);
+    bool reused = getObject()->getSolvedSketch().isSetUpReused();
+    auto line = getObject()->getGeometry<Part::GeomLineSegment>(geoId);
+    double length = (line->getEndPoint() - line->getStartPoint()).Length();
+
+    auto horizontal = std::make_unique<Sketcher::Constraint>();
+    horizontal->Type = Sketcher::ConstraintType::Horizontal;
+    horizontal->First = geoId;
+    getObject()->addConstraint(std::move(horizontal));
+    getObject()->solve();
+    bool reusedAfterNewConstraint = getObject()->getSolvedSketch().isSetUpReused();
+
+    // Assert
+    EXPECT_EQ(err, 0);
+    EXPECT_TRUE(reused);
+    EXPECT_NEAR(length, 2.0, 1e-7);
+    EXPECT_FALSE(reusedAfterNewConstraint);
+}
+
+TEST_F(SketchObjectTest, testExternalGeometryProjectionIsCached)
+{
+    // Arrange
+    auto doc = getObject()->getDocument();
+    auto box = static_cast<Part::Box*>(doc->addObject("Part::Box"));
+    doc->recompute();
+    getObject()->addExternal(box, "Edge1");
+    doc->recompute();
+
+    // Act
+    auto before = getObject()->getExternalGeometryCacheStats();
+    getObject()->rebuildExternalGeometry();
+    auto unchanged = getObject()->getExternalGeometryCacheStats();
+    box->Height.setValue(box->Height.getValue() * 2);
+    doc->recompute();
+    auto changed = getObject()->getExternalGeometryCacheStats();
+
+    // Assert
+    EXPECT_EQ(unchanged.hits, before.hits + 1);
+    EXPECT_EQ(unchanged.misses, before.misses);
+    EXPECT_GT(changed.misses, unchanged.misses);
+    // the two axes and the projected edge
+    EXPECT_EQ(getObject()->getExternalGeometryCount(), 3);
+}
+
+TEST_F(SketchObjectTest, testSetDatumOfBlockedGeometryReusesSolverSystem)
+{
+    // Arrange
+    auto addLine = [this](const Base::Vector3d& p1, const Base::Vector3d& p2) {
+        std::unique_ptr<Part::Geometry> geoline(new Part::GeomLineSegment());
+        static_cast<Part::GeomLineSegment*>(geoline.get())->setPoints(p1, p2);
+        return getObject()->addGeometry(geoline.get());
+    };
+    auto addConstraint = [this](Sketcher::ConstraintType type, int geoId, double value) {
+        auto constraint = std::make_unique<Sketcher::Constraint>();
+        constraint->Type = type;
+        constraint->First = geoId;
+        constraint->setValue(value);
+        return getObject()->addConstraint(std::move(constraint));
+    };
+    auto getLength = [this](int geoId) {
+        auto line = getObject()->getGeometry<Part::GeomLineSegment>(geoId);
+        return (line->getEndPoint() - line->getStartPoint()).Length();
+    };
+    int blockedId = addLine(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(1.0, 0.0, 0.0));
+    int otherId = addLine(Base::Vector3d(0.0, 2.0, 0.0), Base::Vector3d(1.0, 2.0, 0.0));
+    auto blockedDistance = addConstraint(Sketcher::ConstraintType::Distance, blockedId, 1.0);
+    addConstraint(Sketcher::ConstraintType::Block, blockedId, 0.0);
+    auto otherDistance = addConstraint(Sketcher::ConstraintType::Distance, otherId, 1.0);
+    getObject()->solve();
+
+    // Act
+    int err1 = getObject()->setDatum(otherDistance, 3.0);
+    bool reused1 = getObject()->getSolvedSketch().isSetUpReused();
+    int err2 = getObject()->setDatum(blockedDistance, 2.0);
+    bool reused2 = getObject()->getSolvedSketch().isSetUpReused();
+
+    // Assert
+    EXPECT_EQ(err1, 0);
+    EXPECT_EQ(err2, 0);
+    EXPECT_TRUE(reused1);
+    EXPECT_TRUE(reused2);
+    EXPECT_NEAR(getLength(otherId), 3.0, 1e-7);
+    EXPECT_NEAR(getLength(blockedId), 2.0, 1e-7);
+}